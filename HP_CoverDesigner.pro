@@ -2,7 +2,7 @@ QT += core gui xml
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets network
 
-CONFIG += c++11
+CONFIG += c++17
 
 # The following define makes your compiler emit warnings if you use
 # any Qt feature that has been marked deprecated (the exact warnings
@@ -34,6 +34,7 @@ SOURCES += \
     src/ImagesViewer.cpp \
     src/MailAddressInput.cpp \
     src/PhoneNumberInput.cpp \
+    src/PreviewPanel.cpp \
     src/ResultTerminal.cpp \
     src/SlidesViewer.cpp \
     src/StartWindow.cpp \
@@ -66,6 +67,7 @@ HEADERS += \
     inc/MailAddressInput.hpp \
     inc/MainWindow.hpp \
     inc/PhoneNumberInput.hpp \
+    inc/PreviewPanel.hpp \
     inc/ResultTerminal.hpp \
     inc/SlidesViewer.hpp \
     inc/StartWindow.hpp \
@@ -85,6 +87,9 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 
 INCLUDEPATH+=inc
 
+# Qt-free sizing core (also available as a static library: core/HPSizingCore.pro)
+include(core/HPSizingCore.pri)
+
 RESOURCES += \
     resources/Images.qrc \
     resources/fonts.qrc \
@@ -0,0 +1,70 @@
+# Sources of the Qt-free sizing core.
+# Included by the GUI project and by HPSizingCore.pro (static library).
+
+INCLUDEPATH += $$PWD/inc
+
+# Default catalog compiled into the program (e.g. WASM build, no I/O at start).
+# Tables are generated by: hpsizing_compile catalog output HPSIZING_TABLES_DIR/CoverParametersTables.hpp
+# and enabled with: CONFIG+=hpsizing_embedded_catalog HPSIZING_TABLES_DIR=<directory>
+hpsizing_embedded_catalog {
+    DEFINES += HPSIZING_EMBEDDED_CATALOG
+    INCLUDEPATH += $$HPSIZING_TABLES_DIR
+}
+
+# SIMD128 kernel of the WASM build (browsers without SIMD support: CONFIG+=hpsizing_no_wasm_simd)
+wasm:!hpsizing_no_wasm_simd {
+    QMAKE_CXXFLAGS += -msimd128
+}
+
+SOURCES += \
+    $$PWD/src/BatchSizer.cpp \
+    $$PWD/src/BulkSizer.cpp \
+    $$PWD/src/CatalogBlob.cpp \
+    $$PWD/src/CatalogIndex.cpp \
+    $$PWD/src/CatalogWatcher.cpp \
+    $$PWD/src/CoverCache.cpp \
+    $$PWD/src/CoverCatalog.cpp \
+    $$PWD/src/CoverOptimizer.cpp \
+    $$PWD/src/CoverSizer.cpp \
+    $$PWD/src/FeasibilityAtlas.cpp \
+    $$PWD/src/LatencyMeter.cpp \
+    $$PWD/src/PlacementSearch.cpp \
+    $$PWD/src/ProductFamilies.cpp \
+    $$PWD/src/RelaxationSearch.cpp \
+    $$PWD/src/RowLayoutSolver.cpp \
+    $$PWD/src/SizingGraph.cpp \
+    $$PWD/src/SizingKernel.cpp \
+    $$PWD/src/SizingKernelAvx2.cpp \
+    $$PWD/src/SizingKernelSse.cpp \
+    $$PWD/src/SizingKernelWasm.cpp \
+    $$PWD/src/SizingMessages.cpp \
+    $$PWD/src/SizingService.cpp \
+    $$PWD/src/ToleranceAnalysis.cpp \
+    $$PWD/src/WorkStealingPool.cpp
+
+HEADERS += \
+    $$PWD/inc/BatchInputs.hpp \
+    $$PWD/inc/BatchSizer.hpp \
+    $$PWD/inc/BulkSizer.hpp \
+    $$PWD/inc/CatalogBlob.hpp \
+    $$PWD/inc/CatalogIndex.hpp \
+    $$PWD/inc/CatalogWatcher.hpp \
+    $$PWD/inc/CoverCache.hpp \
+    $$PWD/inc/CoverCatalog.hpp \
+    $$PWD/inc/CoverOptimizer.hpp \
+    $$PWD/inc/CoverSizer.hpp \
+    $$PWD/inc/EmbeddedCatalog.hpp \
+    $$PWD/inc/FeasibilityAtlas.hpp \
+    $$PWD/inc/LatencyMeter.hpp \
+    $$PWD/inc/PlacementSearch.hpp \
+    $$PWD/inc/ProductFamilies.hpp \
+    $$PWD/inc/RelaxationSearch.hpp \
+    $$PWD/inc/RowLayoutSolver.hpp \
+    $$PWD/inc/SizingGraph.hpp \
+    $$PWD/inc/SizingKernel.hpp \
+    $$PWD/inc/SizingMessages.hpp \
+    $$PWD/inc/SizingService.hpp \
+    $$PWD/inc/SizingTypes.hpp \
+    $$PWD/inc/ToleranceAnalysis.hpp \
+    $$PWD/inc/WorkStealingPool.hpp \
+    $$PWD/src/SizingKernelBody.hpp
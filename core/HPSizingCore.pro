@@ -0,0 +1,10 @@
+# Static library with the sizing algorithm of the s|HP| cover.
+# It has no Qt dependencies and can be linked into native tools.
+
+TEMPLATE = lib
+TARGET = hpsizing
+
+CONFIG += staticlib c++17
+CONFIG -= qt
+
+include(HPSizingCore.pri)
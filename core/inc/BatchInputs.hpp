@@ -0,0 +1,54 @@
+#ifndef BATCHINPUTS_HPP
+#define BATCHINPUTS_HPP
+
+/*!
+ * \file
+ * \brief Structures of the batch inputs and outputs
+ *
+ * This file contains the structures describing the batch
+ * inputs and outputs laid out as flat arrays (structure of
+ * arrays), shared by BatchSizer and the sizing kernels.
+ */
+
+#include "SizingTypes.hpp"
+
+/*!
+ * \brief Inputs of the batch laid out as flat arrays
+ *
+ * Every pointer refers to the caller-owned array with one value
+ * per item of the batch. Meaning of the values is the same as in
+ * SizingInput (-1 for the data not given by the user).
+ */
+struct BatchInputs
+{
+    /*! Dimensions of the heat pumps (width, depth, height) */
+    const int *device[DimNum];
+    /*! Distances to the obstacles (left, right, back) */
+    const int *obstacles[DimNum];
+    /*! Inner spaces of the covers (sides, front, back, top) */
+    const int *spaces[DevSides];
+};
+/*!
+ * \brief Outputs of the batch laid out as flat arrays
+ *
+ * Every pointer refers to the caller-owned array with one value
+ * per item of the batch. Dimensions of the items, for which the
+ * cover has not been generated, are set to 0.
+ */
+struct BatchOutputs
+{
+    /*! Inner dimensions of the covers (width, depth, height) */
+    uint16_t *inner_dim[DimNum];
+    /*! Outer dimensions of the covers (width, depth, height) */
+    uint16_t *outer_dim[DimNum];
+    /*! Total numbers of the wall modules */
+    uint8_t *modules;
+    /*! Error codes (GenErrors, COVER_OK for the standard cover) */
+    uint8_t *errors;
+    /*! Shifts of the devices to the right (off-center placement, nullptr - centered covers only) */
+    int16_t *shift = nullptr;
+    /*! Orientations of the devices (1 - rotated by 90 degrees, nullptr - typed orientation only) */
+    uint8_t *rotated = nullptr;
+};
+
+#endif // BATCHINPUTS_HPP
@@ -0,0 +1,51 @@
+#ifndef BATCHSIZER_HPP
+#define BATCHSIZER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class BatchSizer
+ *
+ * This file contains definition of the class BatchSizer,
+ * which sizes many covers given as flat arrays in one call.
+ */
+
+#include <cstddef>
+#include "SizingKernel.hpp"
+
+/*!
+ * \brief Class that sizes many covers in one call
+ *
+ * BatchSizer runs the sizing algorithm over N inputs given as
+ * flat arrays and writes N results into the arrays provided by
+ * the caller. Items are sized by the vectorized SizingKernel,
+ * thus there is no heap allocation per item.
+ */
+class BatchSizer
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Vectorized kernel used for all items of the batch
+         */
+        SizingKernel kernel;
+
+    public:
+        /*!
+         * \brief Initialization of the class BatchSizer with the given parts library
+         */
+        explicit BatchSizer(const CoverCatalog & parts);
+        /*!
+         * \brief Return the kernel used by the batch (e.g. to force the instruction set)
+         *
+         * \return Reference to the kernel
+         */
+        SizingKernel & returnKernel() { return this->kernel; }
+        /*!
+         * \brief Size the covers for all items of the batch
+         */
+        size_t sizeBatch(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const;
+};
+
+#endif // BATCHSIZER_HPP
@@ -0,0 +1,190 @@
+#ifndef BULKSIZER_HPP
+#define BULKSIZER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class BulkSizer
+ *
+ * This file contains definition of the class BulkSizer,
+ * which sizes the covers of the whole site survey exported
+ * as the CSV file (one heat pump per row) and streams the
+ * results to the CSV or JSONL file in constant memory.
+ */
+
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "BatchSizer.hpp"
+#include "WorkStealingPool.hpp"
+
+/*!
+ * \brief Format of the results file
+ */
+enum BulkFormat
+{
+    BULK_CSV,  /*! One result per row, columns separated by commas */
+    BULK_JSONL /*! One JSON object per line */
+};
+/*!
+ * \brief Statistics of the streamed file
+ */
+struct BulkStats
+{
+    /*! Number of the sized rows (without the header and empty lines) */
+    uint64_t rows = 0;
+    /*! Number of the standard covers */
+    uint64_t generated = 0;
+    /*! Number of the rows, which could not be read (wrong number of values or wrong value) */
+    uint64_t invalid = 0;
+    /*! Duration of the whole stream in seconds */
+    double seconds = 0.0;
+};
+
+/*!
+ * \brief Class that implements the streaming sizing of the site surveys
+ *
+ * Input rows have the same ten values as DataWindow (device, obstacles,
+ * inner spaces) separated by commas or semicolons, the empty value or
+ * -1 means the data not given (device is required). The first line is
+ * skipped, if it is not numeric (header). File is read in the blocks of
+ * the fixed size, cut at the last complete line. Each block is parsed
+ * into the flat arrays, sized by BatchSizer and formatted by the task
+ * of the pool, while the calling thread reads the next blocks and
+ * writes the finished ones. Blocks live in the ring of the fixed number
+ * of slots, which are reused, so no memory is allocated per row. Block
+ * is written only after all previous ones (input order) and the slot
+ * is read again only after it has been written, thus the slow output
+ * stops the reading (backpressure) and memory does not depend on the
+ * size of the file.
+ */
+class BulkSizer
+{
+    private:
+
+        /*!
+         * \brief State of the slot of the ring
+         */
+        enum SlotState
+        {
+            SLOT_FREE,   /*! Can be filled with the next block */
+            SLOT_SIZING, /*! Parsed and sized by the pool */
+            SLOT_DONE    /*! Results ready to be written */
+        };
+        /*!
+         * \brief One block of the file with its buffers (reused)
+         */
+        struct BulkChunk
+        {
+            /*! Complete lines of the block */
+            std::string text;
+            /*! Formatted results of the block */
+            std::string output;
+            /*! Values of the rows (device, obstacles, spaces) */
+            std::vector<int> inputs[2 * DimNum + DevSides];
+            /*! Inner and outer dimensions of the covers */
+            std::vector<uint16_t> dims[2 * DimNum];
+            /*! Total numbers of the wall modules */
+            std::vector<uint8_t> modules;
+            /*! Error codes of the generator */
+            std::vector<uint8_t> errors;
+            /*! Numbers of the lines in the file (from 1) */
+            std::vector<uint64_t> lines;
+            /*! Rows read correctly (others are not sized) */
+            std::vector<uint8_t> valid;
+            /*! Number of the first line of the block */
+            uint64_t first_line = 1;
+            /*! Number of the rows of the block */
+            size_t rows = 0;
+            /*! Number of the invalid rows of the block */
+            size_t invalid = 0;
+            /*! Number of the standard covers of the block */
+            size_t generated = 0;
+            /*! State of the slot */
+            SlotState state = SLOT_FREE;
+        };
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Batch generator shared by all tasks
+         */
+        BatchSizer batch;
+        /*!
+         * \brief Pool, which sizes the blocks (shared with other users)
+         */
+        WorkStealingPool & pool;
+        /*!
+         * \brief Size of the block read at once
+         */
+        size_t chunk_bytes;
+        /*!
+         * \brief Ring of the blocks
+         */
+        std::vector<std::unique_ptr<BulkChunk>> chunks;
+        /*!
+         * \brief Lock of the states of the slots
+         */
+        std::mutex lock;
+        /*!
+         * \brief Notification about the finished block
+         */
+        std::condition_variable finished;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Default size of the block read at once (1 MiB)
+         */
+        static constexpr size_t DefaultChunkBytes = 1 << 20;
+        /*!
+         * \brief Number of the values in the row
+         */
+        static constexpr int RowValues = 2 * DimNum + DevSides;
+        /*!
+         * \brief Largest value accepted by the GUI (DimInput)
+         */
+        static constexpr int MaxDimension = 2000;
+        /*!
+         * \brief Code of the row, which could not be read (after the codes of GenErrors)
+         */
+        static constexpr uint8_t InvalidRow = GenErrors::COVER_OK + 1;
+        /*!
+         * \brief Header of the results in the CSV format
+         */
+        static constexpr char const *CsvHeader = "line,inner_width,inner_depth,inner_height,"
+                                                 "outer_width,outer_depth,outer_height,modules,status\n";
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Read the values of one row
+         */
+        static bool parseRow(const char *begin, const char *end, int values[RowValues]);
+        /*!
+         * \brief Parse, size and format one block
+         */
+        void sizeChunk(BulkChunk & chunk, BulkFormat format, bool header_allowed) const;
+        /*!
+         * \brief Append the result of one row in the given format
+         */
+        static void formatRow(const BulkChunk & chunk, size_t row, BulkFormat format, std::string & output);
+
+    public:
+        /*!
+         * \brief Initialization of the class BulkSizer with the given parts library
+         */
+        BulkSizer(const CoverCatalog & parts, WorkStealingPool & workers, size_t block_bytes = DefaultChunkBytes);
+        /*!
+         * \brief Size every row of the input stream and write the results in the input order
+         */
+        bool sizeStream(std::FILE *input, std::FILE *output, BulkFormat format, BulkStats & stats);
+        /*!
+         * \brief Return the name of the error code used in the results
+         */
+        static const char * statusName(uint8_t error);
+};
+
+#endif // BULKSIZER_HPP
@@ -0,0 +1,91 @@
+#ifndef CATALOGBLOB_HPP
+#define CATALOGBLOB_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CatalogBlob
+ *
+ * This file contains definition of the class CatalogBlob,
+ * which compiles the parts library into the binary form and
+ * loads it back without parsing the text.
+ */
+
+#include <ostream>
+#include <string>
+#include "CoverCatalog.hpp"
+
+/*!
+ * \brief Class that implements the compiled (binary) parts library
+ *
+ * Compiled catalog is the block of the 32-bit little-endian words
+ * with the fixed layout - header (magic, version, size, CRC-32 of
+ * the data, number of the widths, depths, heights and wall modules)
+ * and then the sorted dimensions, all corrections in the fixed-point
+ * format and the choice of the stack of the wall modules.
+ * There are no pointers and no text, so the file can be mapped into
+ * the memory and the values are copied without any parsing (the index
+ * of the catalog is rebuilt). Loader checks the header, number of the
+ * parts, size and checksum before anything is used, so the damaged or
+ * outdated file is rejected. Text file stays the source of the parameters - the
+ * compiled one is generated from it by the build (hpsizing_compile).
+ * The same values can be also written as the C++ header with the
+ * constexpr tables, which is compiled into the program (EmbeddedCatalog).
+ */
+class CatalogBlob
+{
+    private:
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Number of the words in the header
+         */
+        static constexpr uint32_t HeaderWords = 8;
+        /*!
+         * \brief Largest number of the parts of one dimension
+         */
+        static constexpr uint32_t MaxParts = 4096;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Read the little-endian word
+         */
+        static uint32_t readWord(const unsigned char *data, size_t word_idx);
+        /*!
+         * \brief Append the little-endian word
+         */
+        static void appendWord(std::string & blob, uint32_t value);
+
+    public:
+        /*!
+         * \brief Identification of the compiled catalog ("HPCB")
+         */
+        static constexpr uint32_t Magic = 0x42435048;
+        /*!
+         * \brief Version of the layout
+         */
+        static constexpr uint32_t Version = 2;
+        /*!
+         * \brief Calculate CRC-32 of the data
+         */
+        static uint32_t checksum(const unsigned char *data, size_t size);
+        /*!
+         * \brief Compile the loaded catalog into the binary form
+         */
+        static std::string compile(const CoverCatalog & catalog);
+        /*!
+         * \brief Load the catalog from the compiled form in the memory
+         */
+        static CatalogPtr load(const void *data, size_t size);
+        /*!
+         * \brief Load the catalog from the compiled file (mapped into the memory)
+         */
+        static CatalogPtr loadFile(const std::string & path);
+        /*!
+         * \brief Write the catalog as the C++ header with the constexpr tables
+         */
+        static void writeHeader(const CoverCatalog & catalog, std::ostream & stream);
+};
+
+#endif // CATALOGBLOB_HPP
@@ -0,0 +1,255 @@
+#ifndef CATALOGINDEX_HPP
+#define CATALOGINDEX_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CatalogIndex
+ *
+ * This file contains definition of the class CatalogIndex,
+ * which keeps the parts library in the form prepared for the
+ * fast lookups (sorted precise dimensions, first-fit tables
+ * and stacks of the wall modules for every required height).
+ */
+
+#include <cstddef>
+#include <vector>
+#include "SizingTypes.hpp"
+
+class CoverCatalog;
+
+/*!
+ * \brief Class that implements the immutable index of the parts library
+ *
+ * CatalogIndex is built once, after the catalog has been loaded.
+ * Every expression of the generator, which depends only on the
+ * catalog, is evaluated here in the fixed-point format and converted
+ * to the millimetres in the same way as in the original algorithm. Part of the given dimension (width
+ * or depth) fits, if its threshold is greater than or equal to the
+ * required inner dimension. First-fit tables map every possible
+ * required dimension to the index of the smallest fitting part, so
+ * the lookup does not depend on the size of the catalog.
+ * Stacks of the wall modules (between the base and the top) are
+ * found by the dynamic programming over the heights of all available
+ * modules - for every reachable height the smallest number of modules
+ * is kept. Stacks are sorted by the height and the tables map every
+ * required height to the lowest stack or to the stack with the fewest
+ * modules, so the lookup is also constant.
+ */
+class CatalogIndex
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Default inner spaces (sides, front, back, top)
+         */
+        int default_spaces[DevSides];
+        /*!
+         * \brief Maximum inner dimensions (width, depth, height)
+         */
+        int max_dim[DimNum];
+        /*!
+         * \brief Thresholds of the available widths and depths (sorted)
+         */
+        std::vector<int> thresholds[DimNum - 1];
+        /*!
+         * \brief Precise inner widths and depths of the available parts
+         */
+        std::vector<int> inner_dim[DimNum - 1];
+        /*!
+         * \brief Precise outer widths and depths of the available parts
+         */
+        std::vector<int> outer_dim[DimNum - 1];
+        /*!
+         * \brief Index of the first fitting part for each required width and depth
+         */
+        std::vector<int> first_fit[DimNum - 1];
+        /*!
+         * \brief Inner heights of the cover for the available stacks (ascending)
+         */
+        std::vector<int> height_sums;
+        /*!
+         * \brief Outer heights of the cover for the available stacks
+         */
+        std::vector<int> outer_heights;
+        /*!
+         * \brief Number of the modules on each wall for the available stacks
+         */
+        std::vector<int> stack_modules;
+        /*!
+         * \brief Number of the modules of each type in the stacks (stack after stack)
+         */
+        std::vector<uint8_t> stack_counts;
+        /*!
+         * \brief Index of the lowest stack for each required height
+         */
+        std::vector<int> height_fit;
+        /*!
+         * \brief Index of the stack with the fewest modules for each required height (many types only)
+         */
+        std::vector<int> parts_fit;
+        /*!
+         * \brief Number of the types of the wall modules
+         */
+        size_t module_types = 0;
+        /*!
+         * \brief Criterion of the choice of the stack used by the generator
+         */
+        StackGoal stack_goal = StackGoal::MIN_STACK_HEIGHT;
+        /*!
+         * \brief Inner height of the cover without wall modules
+         */
+        int base_height = 0;
+        /*!
+         * \brief Difference of the inner heights of the consecutive stacks
+         */
+        int module_height = 0;
+        /*!
+         * \brief Increase of the inner height by one standard module
+         */
+        int standard_step = 0;
+        /*!
+         * \brief True if the consecutive stacks differ by the same height
+         */
+        bool constant_step = false;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Maximum number of the modules on each wall kept in the index
+         */
+        static constexpr int MaxIndexModules = 127;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Build the first-fit table for the sorted thresholds
+         */
+        static void buildFirstFit(const std::vector<int> & sorted, std::vector<int> & table);
+        /*!
+         * \brief Find all stacks of the wall modules up to the maximum height
+         */
+        void buildStacks(const std::vector<int> & steps, int max_height, FixedDim out_correction);
+        /*!
+         * \brief Build the table of the stacks with the fewest modules
+         */
+        void buildPartsFit();
+
+    public:
+        /*!
+         * \brief Initialization of the class CatalogIndex
+         */
+        CatalogIndex();
+        /*!
+         * \brief Build the index from the sorted catalog
+         */
+        void build(const CoverCatalog & catalog);
+        /*!
+         * \brief Replace the inner spaces not given by the user (-1) with the default ones
+         */
+        void resolveDefaults(SizingInput & input) const;
+        /*!
+         * \brief Find the smallest part that fits the required width or depth
+         */
+        int findPart(DIM_ID dim_idx, int required) const;
+        /*!
+         * \brief Find the stack of the wall modules for the required height (goal of the catalog)
+         *
+         * \param[in] required - required inner height
+         * \return Index of the stack or -1 if height is not available
+         */
+        int findStack(int required) const { return findStack(required, this->stack_goal); }
+        /*!
+         * \brief Find the stack of the wall modules for the required height
+         */
+        int findStack(int required, StackGoal goal) const;
+        /*!
+         * \brief Find the size of the cover with the given inner height
+         */
+        COVER_SIZE findCoverSize(int inner_height) const;
+        /*!
+         * \brief Return default inner space
+         *
+         * \param[in] space_idx - index of the space (sides, front, back, top)
+         * \return Value of the default space
+         */
+        int returnDefaultSpace(uint8_t space_idx) const { return this->default_spaces[space_idx]; }
+        /*!
+         * \brief Return maximum inner dimension of the standard cover
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Value of the maximum dimension
+         */
+        int returnMaxDim(DIM_ID dim_idx) const { return this->max_dim[dim_idx]; }
+        /*!
+         * \brief Return precise inner dimensions of the parts (width or depth)
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Constant reference to the array with dimensions
+         */
+        const std::vector<int> & returnInnerDims(DIM_ID dim_idx) const { return this->inner_dim[dim_idx]; }
+        /*!
+         * \brief Return precise outer dimensions of the parts (width or depth)
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Constant reference to the array with dimensions
+         */
+        const std::vector<int> & returnOuterDims(DIM_ID dim_idx) const { return this->outer_dim[dim_idx]; }
+        /*!
+         * \brief Return the first-fit table of the given dimension (width or depth)
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Constant reference to the table (-1 if no part fits)
+         */
+        const std::vector<int> & returnFirstFit(DIM_ID dim_idx) const { return this->first_fit[dim_idx]; }
+        /*!
+         * \brief Return inner heights of the cover for the available stacks
+         *
+         * \return Constant reference to the array with heights (ascending)
+         */
+        const std::vector<int> & returnInnerHeights() const { return this->height_sums; }
+        /*!
+         * \brief Return outer heights of the cover for the available stacks
+         *
+         * \return Constant reference to the array with heights
+         */
+        const std::vector<int> & returnOuterHeights() const { return this->outer_heights; }
+        /*!
+         * \brief Return number of the modules on each wall for the available stacks
+         *
+         * \return Constant reference to the array with numbers of modules
+         */
+        const std::vector<int> & returnStackModules() const { return this->stack_modules; }
+        /*!
+         * \brief Return number of the modules of the given type in the stack
+         *
+         * \param[in] stack_idx - index of the stack
+         * \param[in] type_idx - index of the module in the sorted heights of the catalog
+         * \return Number of the modules on each wall
+         */
+        int returnModuleCount(int stack_idx, size_t type_idx) const { return this->stack_counts[stack_idx * module_types + type_idx]; }
+        /*!
+         * \brief Return number of the types of the wall modules
+         *
+         * \return Number of the types
+         */
+        size_t returnModuleTypesNum() const { return this->module_types; }
+        /*!
+         * \brief Return criterion of the choice of the stack used by the generator
+         *
+         * \return Goal of the catalog
+         */
+        StackGoal returnStackGoal() const { return this->stack_goal; }
+        /*!
+         * \brief Return the table with the stack for each required height (goal of the catalog)
+         *
+         * \return Constant reference to the table (-1 if height is not available)
+         */
+        const std::vector<int> & returnHeightFit() const
+        {
+            return (this->stack_goal == StackGoal::MIN_STACK_PARTS && this->module_types > 1) ? this->parts_fit : this->height_fit;
+        }
+};
+
+#endif // CATALOGINDEX_HPP
@@ -0,0 +1,153 @@
+#ifndef CATALOGWATCHER_HPP
+#define CATALOGWATCHER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CatalogWatcher
+ *
+ * This file contains definition of the class CatalogWatcher,
+ * which loads the changed parts library in the background and
+ * publishes it to the generators of the running program.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "CoverCatalog.hpp"
+
+/*!
+ * \brief Class that implements the hot reloading of the parts library
+ *
+ * CatalogWatcher checks the modification time and size of the file
+ * with the parameters (text or compiled catalog, by the extension)
+ * in its own thread. Changed file is loaded and validated there,
+ * so the UI thread and the generators do not wait for the parsing.
+ * Only the valid catalog is published - damaged or incomplete file
+ * is rejected and the previous catalog stays in use.
+ * Publication is RCU-style: catalog is immutable and shared, the
+ * pointer is replaced atomically and the version is increased after
+ * it. Users compare the version (one atomic load, no lock) and take
+ * the new catalog only after the change. Sizings already running keep
+ * their reference to the old catalog, which is released by the last one.
+ */
+class CatalogWatcher
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Path to the watched file
+         */
+        std::string path;
+        /*!
+         * \brief Time between the checks of the file
+         */
+        std::chrono::milliseconds interval;
+        /*!
+         * \brief Last published catalog (accessed only atomically)
+         */
+        CatalogPtr catalog;
+        /*!
+         * \brief Number of the published catalogs
+         */
+        std::atomic<uint64_t> version{0};
+        /*!
+         * \brief Number of the rejected (not valid) files
+         */
+        std::atomic<uint64_t> rejected{0};
+        /*!
+         * \brief Modification time of the last loaded file
+         */
+        std::chrono::nanoseconds::rep last_time = 0;
+        /*!
+         * \brief Size of the last loaded file (-1 - not loaded yet)
+         */
+        int64_t last_size = -1;
+        /*!
+         * \brief Thread checking the file
+         */
+        std::thread worker;
+        /*!
+         * \brief True if the thread should finish
+         */
+        bool stopping = false;
+        /*!
+         * \brief Lock of the stop request (never taken by the generators)
+         */
+        std::mutex stop_lock;
+        /*!
+         * \brief Lock of the file checks (thread and manual reload)
+         */
+        std::mutex reload_lock;
+        /*!
+         * \brief Wakes the thread up when stopped
+         */
+        std::condition_variable wake_up;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Default time between the checks of the file in milliseconds
+         */
+        static constexpr int DefaultInterval = 1000;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Check the file periodically until stopped
+         */
+        void run();
+        /*!
+         * \brief Load the catalog from the file (text or compiled)
+         */
+        CatalogPtr loadFile() const;
+
+    public:
+        /*!
+         * \brief Initialization of the class CatalogWatcher
+         */
+        explicit CatalogWatcher(const std::string & file_path,
+                                std::chrono::milliseconds check_interval = std::chrono::milliseconds(DefaultInterval));
+        /*!
+         * \brief Stop the thread before destruction
+         */
+        ~CatalogWatcher();
+        /*!
+         * \brief Start checking the file in the background
+         */
+        void start();
+        /*!
+         * \brief Stop checking the file
+         */
+        void stop();
+        /*!
+         * \brief Check the file now and publish the catalog if changed
+         */
+        bool reload();
+        /*!
+         * \brief Publish the given catalog
+         */
+        void publish(CatalogPtr parts);
+        /*!
+         * \brief Return the last published catalog
+         */
+        CatalogPtr returnCatalog() const;
+        /*!
+         * \brief Return number of the published catalogs (0 - nothing published)
+         *
+         * \return Version of the catalog
+         */
+        uint64_t returnVersion() const { return this->version.load(std::memory_order_acquire); }
+        /*!
+         * \brief Return number of the rejected files
+         *
+         * \return Number of the not valid files
+         */
+        uint64_t returnRejected() const { return this->rejected.load(std::memory_order_relaxed); }
+};
+
+#endif // CATALOGWATCHER_HPP
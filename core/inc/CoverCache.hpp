@@ -0,0 +1,178 @@
+#ifndef COVERCACHE_HPP
+#define COVERCACHE_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CoverCache
+ *
+ * This file contains definition of the class CoverCache,
+ * which remembers the results of the generator, so the
+ * repeated inputs are not sized again.
+ */
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "CoverSizer.hpp"
+
+/*!
+ * \brief Hash of the normalized input data
+ */
+struct SizingInputHash
+{
+    size_t operator()(const SizingInput & input) const;
+};
+/*!
+ * \brief Comparison of the normalized input data
+ */
+struct SizingInputEqual
+{
+    bool operator()(const SizingInput & first, const SizingInput & second) const;
+};
+
+/*!
+ * \brief Class that implements the cache of the generator results
+ *
+ * CoverCache is placed in front of CoverSizer. Input data is
+ * normalized first (default inner spaces are resolved), so all
+ * inputs, which lead to the same cover, share one entry. Cache has
+ * fixed number of entries and replaces them with the CLOCK policy
+ * (approximation of LRU, which does not reorder anything on hit).
+ * All entries are dropped when the catalog changes. Cache can be
+ * used by many threads - only the lookup is locked, the sizing of
+ * the missing results is done outside the lock. Generator with the
+ * catalog is published like in CatalogWatcher: every request takes
+ * one atomic snapshot of it and the version of the catalog, so the
+ * catalog can be replaced while other threads are sizing. Results
+ * sized with the replaced catalog are neither returned nor stored.
+ */
+class CoverCache
+{
+    private:
+
+        /*!
+         * \brief One entry of the cache
+         */
+        struct CacheEntry
+        {
+            /*! Normalized input data */
+            SizingInput key;
+            /*! Remembered result of the generator */
+            SizingResult result;
+            /*! Version of the catalog, which sized the result */
+            uint64_t version = 0;
+            /*! True if the entry has been used since the last pass of the clock hand */
+            bool referenced = false;
+        };
+        /*!
+         * \brief Generator with the catalog (immutable, replaced as a whole)
+         */
+        struct CatalogSnapshot
+        {
+            /*! Generator sharing the catalog */
+            CoverSizer sizer;
+            /*! Number of the replacements of the catalog */
+            uint64_t version = 0;
+        };
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Generator used for the missing results (accessed only atomically)
+         */
+        std::shared_ptr<const CatalogSnapshot> current;
+        /*!
+         * \brief Entries of the cache (at most capacity)
+         */
+        std::vector<CacheEntry> entries;
+        /*!
+         * \brief Position of the entry for the given input
+         */
+        std::unordered_map<SizingInput, size_t, SizingInputHash, SizingInputEqual> slots;
+        /*!
+         * \brief Maximum number of entries
+         */
+        size_t capacity;
+        /*!
+         * \brief Next candidate for the replacement
+         */
+        size_t clock_hand = 0;
+        /*!
+         * \brief Number of results found in the cache
+         */
+        uint64_t hits = 0;
+        /*!
+         * \brief Number of results sized by the generator
+         */
+        uint64_t misses = 0;
+        /*!
+         * \brief Lock of the entries and counters
+         */
+        mutable std::mutex lock;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Default number of entries
+         */
+        static constexpr size_t DefaultCapacity = 4096;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Remember the result of the generator
+         */
+        void store(const SizingInput & key, const SizingResult & result, uint64_t version);
+
+    public:
+        /*!
+         * \brief Initialization of the class CoverCache
+         */
+        explicit CoverCache(size_t entries_num = DefaultCapacity);
+        /*!
+         * \brief Initialization of the class CoverCache with the given parts library
+         */
+        CoverCache(CatalogPtr parts, size_t entries_num = DefaultCapacity);
+        /*!
+         * \brief Replace the parts library and drop all entries
+         */
+        void setCatalog(CatalogPtr parts);
+        /*!
+         * \brief Generate the cover or take the remembered result
+         */
+        bool generateCover(const SizingInput & dimensions, SizingResult & result);
+        /*!
+         * \brief Drop all entries (counters are kept)
+         */
+        void clear();
+        /*!
+         * \brief Return the generator used for the missing results
+         *
+         * Copy shares the catalog, so it stays valid when the catalog
+         * of the cache is replaced.
+         *
+         * \return Generator with the current catalog
+         */
+        CoverSizer returnSizer() const { return std::atomic_load(&this->current)->sizer; }
+        /*!
+         * \brief Return number of results found in the cache
+         */
+        uint64_t returnHits() const;
+        /*!
+         * \brief Return number of results sized by the generator
+         */
+        uint64_t returnMisses() const;
+        /*!
+         * \brief Return number of the occupied entries
+         */
+        size_t returnSize() const;
+        /*!
+         * \brief Return maximum number of entries
+         *
+         * \return Capacity of the cache
+         */
+        size_t returnCapacity() const { return this->capacity; }
+};
+
+#endif // COVERCACHE_HPP
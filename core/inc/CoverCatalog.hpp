@@ -0,0 +1,268 @@
+#ifndef COVERCATALOG_HPP
+#define COVERCATALOG_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CoverCatalog
+ *
+ * This file contains definition of the class CoverCatalog,
+ * which stores the parameters of the available cover parts
+ * (parts library) and parses them from the text provided
+ * by the caller.
+ */
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "CatalogIndex.hpp"
+
+/*!
+ * \brief Structure with the names of all parameters
+ *
+ * Names of the parameters corresponds to the configuration
+ * file. Thus, those strings are used to parse the custom
+ * config and correctly distribute the values inside the
+ * CoverCatalog object.
+ */
+struct VariableNames
+{
+    /*! Possible widths of the cover */
+    std::string BASE_LENGTH = "lengths";
+    /*! Possible depths of the cover */
+    std::string BASE_WIDTH = "widths";
+    /*! Heights of the modules (base, standard and top) */
+    std::string BASE_HEIGHT = "heights";
+    /*! Width correction value, which converts inner width to outer width */
+    std::string OUT_LENGTH = "out_length_param";
+    /*! Depth correction value, which converts inner depth to outer depth */
+    std::string OUT_WIDTH = "out_width_param";
+    /*! Height correction value, which converts inner height to outer height */
+    std::string OUT_HEIGHT = "out_height_param";
+    /*! Width correction value, which converts approx inner width to the accurate one */
+    std::string ACC_LENGTH = "acc_length_param";
+    /*! Depth correction value, which converts approx inner depth to the accurate one */
+    std::string ACC_WIDTH = "acc_width_param";
+    /*! Height correction value, which converts approx inner height to the accurate one */
+    std::string ACC_HEIGHT= "acc_height_param";
+    /*! Minimum space between inner surface of the cover and front of the device */
+    std::string FRONT_SPACE = "front_space";
+    /*! Minimum space between inner surface of the cover and sides of the device */
+    std::string SIDE_SPACE = "side_space";
+    /*! Minimum space between inner surface of the cover and back of the device */
+    std::string BACK_SPACE = "back_space";
+    /*! Minimum space between inner surface of the cover and top of the device */
+    std::string TOP_SPACE = "top_space";
+    /*! Minimum distance to the wall behind the device, for which cover should be standard */
+    std::string WALL_SPACE = "wall_space";
+    /*! Heights of the wall modules stacked between the base and the top (optional) */
+    std::string MODULE_HEIGHTS = "module_heights";
+    /*! Choice of the stack of the wall modules: 0 - lowest, 1 - fewest modules (optional) */
+    std::string STACK_GOAL = "stack_goal";
+};
+
+/*!
+ * \brief Class that implements the parts library of the sHP cover
+ *
+ * CoverCatalog keeps the dimensions of the available parts
+ * and the corrections needed to calculate the precise inner
+ * and outer dimensions of the cover. It does not read any
+ * files on its own - the caller provides the contents of the
+ * configuration file, so the same catalog can be loaded from
+ * Qt resources, a plain file or a network message. After
+ * loading, dimensions are sorted and the CatalogIndex is
+ * built once, so the generator does not repeat this work.
+ * Loaded catalog is never modified, thus one instance can
+ * be shared (CatalogPtr) by many generators and threads.
+ * Values are converted exactly from the decimal text to the
+ * fixed-point format (tenths of the millimetre). Text is parsed
+ * in one pass, in place, and every error (unknown or repeated
+ * parameter, invalid value) stops the loading and is reported
+ * with its line and column.
+ */
+class CoverCatalog
+{
+    // Wczytanie skompilowanego katalogu bez parsowania tekstu
+    friend class CatalogBlob;
+    // Katalog wkompilowany w program (tablice constexpr)
+    friend class EmbeddedCatalog;
+
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Base dimensions available in the parts library
+         */
+        std::vector<FixedDim> base_dimensions[DimNum];
+        /*!
+         * \brief Corrections used to caclulate the preceise inner dimensions
+         */
+        FixedDim acc_in_dimensions[DimNum];
+        /*!
+         * \brief Corrections used to caclulate the preceise outer dimensions
+         */
+        FixedDim acc_out_dimensions[DimNum];
+        /*!
+         * \brief Required minimal spaces inside the cover
+         */
+        FixedDim inner_offsets[DevSides];
+        /*!
+         * \brief Minimal distance to the wall behind for the standard cover
+         */
+        FixedDim wall_offset = 0;
+        /*!
+         * \brief Heights of the wall modules (only the standard one if empty)
+         */
+        std::vector<FixedDim> module_heights;
+        /*!
+         * \brief Criterion of the choice of the wall modules stack
+         */
+        StackGoal stack_goal = StackGoal::MIN_STACK_HEIGHT;
+        /*!
+         * \brief Index of the parts prepared for the fast lookups
+         */
+        CatalogIndex index;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Constant structure with the names of the config parameters
+         */
+        static const VariableNames params;
+        /*!
+         * \brief Number of the parameters in the configuration file
+         */
+        static constexpr uint8_t ParamsNum = 16;
+        /*!
+         * \brief Index of the heights of the wall modules among the parameters
+         */
+        static constexpr int8_t ModulesParam = 14;
+        /*!
+         * \brief Index of the choice of the stack among the parameters
+         */
+        static constexpr int8_t GoalParam = 15;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Read and analyze the line of the file
+         */
+        bool readLine(const char *begin, const char *end, size_t line_num, uint16_t & read_params);
+        /*!
+         * \brief Find the index of the parameter with the given name
+         */
+        static int8_t findParameter(std::string_view name);
+        /*!
+         * \brief Convert the decimal number to the fixed-point format
+         */
+        static const char *parseFixed(const char *begin, const char *end, FixedDim & value);
+        /*!
+         * \brief Check if the sign separates the values
+         *
+         * \param[in] sign - checked sign
+         * \return True if space, tab or carriage return and false otherwise
+         */
+        static bool isSpace(char sign) { return sign == ' ' || sign == '\t' || sign == '\r'; }
+        /*!
+         * \brief Skip the spaces and tabs
+         */
+        static const char *skipSpaces(const char *begin, const char *end);
+        /*!
+         * \brief Report the error of the configuration file with its position
+         */
+        static void reportError(size_t line_num, size_t offset, const char *message, std::string_view var_name);
+        /*!
+         * \brief Sort the base dimensions in the ascending order
+         */
+        void sortDimensions();
+
+    public:
+        /*!
+         * \brief Initialization of the class CoverCatalog
+         */
+        CoverCatalog();
+        /*!
+         * \brief Read parameters of the generator from the contents of the configuration file
+         */
+        bool readParameters(const std::string & contents);
+        /*!
+         * \brief Read parameters of the generator from the raw bytes of the configuration file
+         */
+        bool readParameters(const char *data, size_t size);
+        /*!
+         * \brief Load the catalog, which can be shared by many generators
+         */
+        static std::shared_ptr<const CoverCatalog> loadShared(const std::string & contents);
+        /*!
+         * \brief Load the catalog from the raw bytes of the configuration file
+         */
+        static std::shared_ptr<const CoverCatalog> loadShared(const char *data, size_t size);
+        /*!
+         * \brief Check if the catalog contains everything needed by the generator
+         */
+        bool isComplete() const;
+        /*!
+         * \brief Display the loaded configuration parameters (debug only)
+         */
+        void printParameters() const;
+        /*!
+         * \brief Return base dimensions of the parts for the given dimension
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Constant reference to the dynamic array with dimensions (tenths of mm)
+         */
+        const std::vector<FixedDim> & returnBaseDimensions(DIM_ID dim_idx) const { return this->base_dimensions[dim_idx]; }
+        /*!
+         * \brief Return correction of the inner dimension
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Value of the correction (tenths of mm)
+         */
+        FixedDim returnInnerCorrection(DIM_ID dim_idx) const { return this->acc_in_dimensions[dim_idx]; }
+        /*!
+         * \brief Return correction of the outer dimension
+         *
+         * \param[in] dim_idx - required dimension (enumeration)
+         * \return Value of the correction (tenths of mm)
+         */
+        FixedDim returnOuterCorrection(DIM_ID dim_idx) const { return this->acc_out_dimensions[dim_idx]; }
+        /*!
+         * \brief Return default inner space (front, side, back, top)
+         *
+         * \param[in] side_idx - index of the side of the device
+         * \return Value of the default space (tenths of mm)
+         */
+        FixedDim returnInnerOffset(uint8_t side_idx) const { return this->inner_offsets[side_idx]; }
+        /*!
+         * \brief Return minimal distance to the wall behind for the standard cover
+         *
+         * \return Value of the distance (tenths of mm)
+         */
+        FixedDim returnWallOffset() const { return this->wall_offset; }
+        /*!
+         * \brief Return heights of the wall modules stacked between the base and the top
+         *
+         * \return Constant reference to the sorted heights (empty - standard module only)
+         */
+        const std::vector<FixedDim> & returnModuleHeights() const { return this->module_heights; }
+        /*!
+         * \brief Return criterion of the choice of the wall modules stack
+         *
+         * \return Goal of the catalog
+         */
+        StackGoal returnStackGoal() const { return this->stack_goal; }
+        /*!
+         * \brief Return index of the parts prepared for the fast lookups
+         *
+         * \return Constant reference to the index
+         */
+        const CatalogIndex & returnIndex() const { return this->index; }
+};
+
+/*!
+ * \brief Shared, immutable catalog (reference counted)
+ */
+typedef std::shared_ptr<const CoverCatalog> CatalogPtr;
+
+#endif // COVERCATALOG_HPP
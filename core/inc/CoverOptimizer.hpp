@@ -0,0 +1,95 @@
+#ifndef COVEROPTIMIZER_HPP
+#define COVEROPTIMIZER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CoverOptimizer
+ *
+ * This file contains definition of the class CoverOptimizer,
+ * which searches all combinations of the available parts for
+ * the best covers, instead of taking the first fitting one.
+ */
+
+#include <vector>
+#include "CoverSizer.hpp"
+#include "WorkStealingPool.hpp"
+
+/*!
+ * \brief Criteria of the cover ranking
+ */
+enum OptimizerGoal
+{
+    MIN_VOLUME,   /*! Smallest outer volume */
+    MIN_FOOTPRINT /*! Smallest outer footprint (width x depth) */
+};
+/*!
+ * \brief One feasible cover found by the optimizer
+ */
+struct CoverCandidate
+{
+    /*! Index of the width part in the catalog index */
+    int length_idx = 0;
+    /*! Index of the depth part in the catalog index */
+    int width_idx = 0;
+    /*! Total number of the wall modules (for both walls) */
+    uint8_t modules = 0;
+    /*! Inner dimensions of the cover */
+    uint16_t inner_dim[DimNum] = {0, 0, 0};
+    /*! Outer dimensions of the cover */
+    uint16_t outer_dim[DimNum] = {0, 0, 0};
+    /*! Value of the ranking criterion (lower is better) */
+    uint64_t score = 0;
+};
+
+/*!
+ * \brief Class that implements the search of the best covers
+ *
+ * CoverOptimizer enumerates every combination of the width,
+ * depth and number of modules, which fits the required inner
+ * dimensions and does not collide with the obstacles. Candidates
+ * are ranked by the outer volume or footprint and the best K are
+ * returned. Search is split into one task per width part and run
+ * on the work-stealing pool. Every task keeps its own K best
+ * candidates and skips the combinations, which cannot beat them,
+ * so the search stays interactive for the large catalogs.
+ */
+class CoverOptimizer
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Generator used to resolve the inputs and check the limits
+         */
+        CoverSizer sizer;
+        /*!
+         * \brief Pool, which runs the search
+         */
+        WorkStealingPool & pool;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Search all combinations with the given width part
+         */
+        void searchLength(const SizingResult & request, OptimizerGoal goal, size_t top_k,
+                          int length_idx, std::vector<CoverCandidate> & best) const;
+
+    public:
+        /*!
+         * \brief Initialization of the class CoverOptimizer
+         */
+        CoverOptimizer(CatalogPtr parts, WorkStealingPool & workers);
+        /*!
+         * \brief Find the best covers for the input data
+         */
+        size_t optimize(const SizingInput & dimensions, OptimizerGoal goal, size_t top_k,
+                        std::vector<CoverCandidate> & candidates) const;
+        /*!
+         * \brief Compare two candidates (better first)
+         */
+        static bool isBetter(const CoverCandidate & first, const CoverCandidate & second);
+};
+
+#endif // COVEROPTIMIZER_HPP
@@ -0,0 +1,134 @@
+#ifndef COVERSIZER_HPP
+#define COVERSIZER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class CoverSizer
+ *
+ * This file contains definition of the class CoverSizer,
+ * which implements the sizing algorithm of the sHP cover
+ * (inner / outer dimensions, number of modules, collisions)
+ * without any dependency on Qt.
+ */
+
+#include "PlacementSearch.hpp"
+#include "SizingGraph.hpp"
+
+/*!
+ * \brief Class that implements the sizing algorithm of the sHP cover
+ *
+ * CoverSizer generates the cover based on the input data
+ * and the parts library shared by the caller. It decides
+ * about success or failure (standard or special cover)
+ * and reports the reason of the failure as the error code,
+ * so the caller can display its own message. Generator is
+ * reentrant - the whole state of the request is kept in the
+ * SizingResult provided by the caller (usually on the stack)
+ * and the catalog is constant, so any number of threads can
+ * size the covers with the same CoverSizer at the same time,
+ * without any heap allocation or locking. In the incremental
+ * mode only the values depending on the changed input data
+ * are computed again (see SizingGraph).
+ */
+class CoverSizer
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Parts library used by the generator (shared, constant)
+         */
+        CatalogPtr catalog;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Calculate the required width
+         */
+        bool countInnerLength(SizingResult & result) const;
+        /*!
+         * \brief Calculate the required depth
+         */
+        bool countInnerWidth(SizingResult & result) const;
+        /*!
+         * \brief Calculate the required height
+         */
+        bool countInnerHeight(SizingResult & result) const;
+        /*!
+         * \brief Calculate the precise outer dimensions of the generated cover
+         */
+        void countOuterDimensions(SizingResult & result) const;
+        /*!
+         * \brief Check if there is a collision with the object on the left or right
+         */
+        bool checkForLengthCollision(const SizingResult & result, int constraint) const;
+        /*!
+         * \brief Check if there is a collision with the object behind the device
+         */
+        bool checkForWidthCollision(const SizingResult & result, int constraint) const;
+        /*!
+         * \brief Find the base dimension available for the approximated one
+         */
+        int pickRightDimension(SizingResult & result, DIM_ID dim_idx) const;
+        /*!
+         * \brief Choose the appropriate number of the wall modules to the required height
+         */
+        int pickRightModulesQuantity(SizingResult & result) const;
+        /*!
+         * \brief Check if the required dimensions can be provided by the available parts
+         */
+        bool searchPartsLibrary(SizingResult & result) const;
+        /*!
+         * \brief Compute one node of the dependency graph
+         */
+        void evaluateNode(SIZING_NODE node, SizingState & state) const;
+        /*!
+         * \brief Build the result of the generator from the values of all nodes
+         */
+        bool assembleResult(const SizingState & state, SizingResult & result) const;
+
+    public:
+        /*!
+         * \brief Initialization of the class CoverSizer
+         */
+        CoverSizer();
+        /*!
+         * \brief Initialization of the class CoverSizer with the given parts library
+         */
+        explicit CoverSizer(CatalogPtr parts);
+        /*!
+         * \brief Replace the parts library used by the generator
+         */
+        void setCatalog(CatalogPtr parts);
+        /*!
+         * \brief Generate the cover
+         */
+        bool generateCover(const SizingInput & dimensions, SizingResult & result) const;
+        /*!
+         * \brief Generate the cover again after the change of the input data
+         */
+        bool updateCover(const SizingInput & dimensions, SizingState & state, SizingResult & result) const;
+        /*!
+         * \brief Move the device inside the cover to avoid the collision on the left or right
+         */
+        bool placeOffCenter(SizingResult & result) const;
+        /*!
+         * \brief Size the device rotated by 90 degrees and keep the better orientation
+         */
+        bool exploreRotation(SizingResult & result, bool off_center = false) const;
+        /*!
+         * \brief Return the parts library used by the generator
+         *
+         * \return Constant reference to the catalog
+         */
+        const CoverCatalog & returnCatalog() const { return *this->catalog; }
+        /*!
+         * \brief Return the shared pointer to the parts library
+         *
+         * \return Shared pointer to the catalog
+         */
+        CatalogPtr returnSharedCatalog() const { return this->catalog; }
+};
+
+#endif // COVERSIZER_HPP
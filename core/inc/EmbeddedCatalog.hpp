@@ -0,0 +1,133 @@
+#ifndef EMBEDDEDCATALOG_HPP
+#define EMBEDDEDCATALOG_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class EmbeddedCatalog
+ *
+ * This file contains definition of the class EmbeddedCatalog,
+ * which gives the default parts library compiled into the program
+ * (constexpr tables generated by hpsizing_compile), so the
+ * generator can start without reading any file.
+ */
+
+#include <array>
+#include <cstddef>
+#include "CoverCatalog.hpp"
+#ifdef HPSIZING_EMBEDDED_CATALOG
+#include "CoverParametersTables.hpp"
+#endif
+
+/*!
+ * \brief Class that implements the parts library compiled into the program
+ *
+ * Tables of the catalog are generated at build time from the
+ * configuration file (hpsizing_compile catalog output tables)
+ * and included only if HPSIZING_EMBEDDED_CATALOG is defined.
+ * Tables are checked by the compiler - dimensions (and heights
+ * of the wall modules, if listed) must be sorted
+ * and there must be exactly three heights of the modules (base,
+ * standard and top), as expected by countInnerHeight. Catalog is
+ * built from the tables once, at the first call, without any
+ * I/O or parsing. Without the tables there is no embedded catalog
+ * and the caller has to load it from the file.
+ */
+class EmbeddedCatalog
+{
+#ifdef HPSIZING_EMBEDDED_CATALOG
+    private:
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Build the catalog from the compiled tables
+         *
+         * \return Shared pointer to the catalog
+         */
+        static CatalogPtr build()
+        {
+            std::shared_ptr<CoverCatalog> catalog = std::make_shared<CoverCatalog>();
+
+            catalog->base_dimensions[DIM_ID::LENGTH].assign(CatalogTables::Lengths.begin(), CatalogTables::Lengths.end());
+            catalog->base_dimensions[DIM_ID::WIDTH].assign(CatalogTables::Widths.begin(), CatalogTables::Widths.end());
+            catalog->base_dimensions[DIM_ID::HEIGHT].assign(CatalogTables::Heights.begin(), CatalogTables::Heights.end());
+            catalog->module_heights.assign(CatalogTables::ModuleHeights.begin(), CatalogTables::ModuleHeights.end());
+
+            for(uint8_t i = 0; i < DimNum; ++i)
+            {
+                catalog->acc_in_dimensions[i] = CatalogTables::InnerCorrections[i];
+                catalog->acc_out_dimensions[i] = CatalogTables::OuterCorrections[i];
+            }
+
+            for(uint8_t i = 0; i < DevSides; ++i)
+                catalog->inner_offsets[i] = CatalogTables::InnerOffsets[i];
+
+            catalog->wall_offset = CatalogTables::WallOffset;
+            catalog->stack_goal = CatalogTables::Goal;
+            catalog->index.build(*catalog);
+
+            return catalog;
+        }
+#endif
+
+    public:
+        /*!
+         * \brief Check if the values are sorted in the ascending order
+         *
+         * \param[in] values - checked table
+         * \return True if sorted and false otherwise
+         */
+        template<size_t Size>
+        static constexpr bool isSorted(const std::array<FixedDim, Size> & values)
+        {
+            for(size_t i = 1; i < Size; ++i)
+            {
+                if(values[i] < values[i - 1])
+                    return false;
+            }
+
+            return true;
+        }
+        /*!
+         * \brief Check if the catalog is compiled into the program
+         *
+         * \return True if the tables are available and false otherwise
+         */
+        static constexpr bool isAvailable()
+        {
+#ifdef HPSIZING_EMBEDDED_CATALOG
+            return true;
+#else
+            return false;
+#endif
+        }
+        /*!
+         * \brief Return the catalog compiled into the program
+         *
+         * \return Shared pointer to the catalog or empty pointer if not compiled in
+         */
+        static CatalogPtr load()
+        {
+#ifdef HPSIZING_EMBEDDED_CATALOG
+            // Zbudowany raz, przy pierwszym użyciu
+            static const CatalogPtr catalog = build();
+
+            return catalog;
+#else
+            return nullptr;
+#endif
+        }
+};
+
+#ifdef HPSIZING_EMBEDDED_CATALOG
+// Sprawdzenie wygenerowanych tablic podczas kompilacji
+static_assert(!CatalogTables::Lengths.empty() && !CatalogTables::Widths.empty(),
+              "Embedded catalog does not contain lengths or widths");
+static_assert(CatalogTables::Heights.size() == DimNum,
+              "Embedded catalog must contain three heights of the modules");
+static_assert(EmbeddedCatalog::isSorted(CatalogTables::Lengths) && EmbeddedCatalog::isSorted(CatalogTables::Widths) &&
+              EmbeddedCatalog::isSorted(CatalogTables::Heights) && EmbeddedCatalog::isSorted(CatalogTables::ModuleHeights),
+              "Dimensions of the embedded catalog are not sorted");
+#endif
+
+#endif // EMBEDDEDCATALOG_HPP
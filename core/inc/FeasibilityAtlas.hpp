@@ -0,0 +1,135 @@
+#ifndef FEASIBILITYATLAS_HPP
+#define FEASIBILITYATLAS_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class FeasibilityAtlas
+ *
+ * This file contains definition of the class FeasibilityAtlas,
+ * which keeps the answers of the generator for the whole input
+ * domain in the compressed tables, so they can be served without
+ * running the generator (e.g. by the instant quote on the website).
+ */
+
+#include <ostream>
+#include <vector>
+#include "CoverSizer.hpp"
+
+/*!
+ * \brief Result of the generator for the range of one required inner dimension
+ *
+ * Required dimension of each axis (width, depth, height) decides on
+ * its own about the part and the error of this axis, so one range
+ * describes every input, which gives the required dimension from
+ * the range.
+ */
+struct AtlasRun
+{
+    /*! First required dimension of the range (range ends where the next one begins) */
+    int begin = 0;
+    /*! State of the axis (ATLAS_PART_FOUND, ATLAS_NO_PART or ATLAS_TOO_LARGE) */
+    int8_t status = 0;
+    /*! Total number of the wall modules (height axis only) */
+    uint8_t modules = 0;
+    /*! Inner dimension of the cover */
+    uint16_t inner_dim = 0;
+    /*! Outer dimension of the cover */
+    uint16_t outer_dim = 0;
+};
+/*!
+ * \brief State of the axis in the range
+ */
+enum AtlasStatus
+{
+    ATLAS_PART_FOUND = 0,  /*! Part (or modules) available */
+    ATLAS_NO_PART = -1,    /*! Within the limit, but no part fits */
+    ATLAS_TOO_LARGE = -2   /*! Above the maximum dimension of the cover */
+};
+
+/*!
+ * \brief Class that implements the precomputed answers of the generator
+ *
+ * FeasibilityAtlas evaluates the generator over the whole range of
+ * every required inner dimension (device with the inner spaces) and
+ * stores only the ranges with the same answer (run-length encoding,
+ * one range per catalog step). Each axis has also the bucket table
+ * with the fixed width, which points to the range containing the
+ * beginning of the bucket. Buckets are not wider than the shortest
+ * range, so the answer is found in constant time. Collisions are
+ * checked with the same integer formulas as in the generator. Atlas
+ * is immutable after building and can be shared by many threads.
+ */
+class FeasibilityAtlas
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Ranges of each axis (width, depth, height) sorted by the beginning
+         */
+        std::vector<AtlasRun> runs[DimNum];
+        /*!
+         * \brief Index of the range containing the beginning of each bucket
+         */
+        std::vector<uint16_t> buckets[DimNum];
+        /*!
+         * \brief Width of the buckets of each axis
+         */
+        int bucket_width[DimNum] = {1, 1, 1};
+        /*!
+         * \brief Default inner spaces (sides, front, back, top)
+         */
+        int default_spaces[DevSides] = {0, 0, 0, 0};
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Largest required dimension (approximated dimensions are 16-bit)
+         */
+        static constexpr int MaxRequired = UINT16_MAX;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Evaluate the generator along one axis and store the ranges
+         */
+        bool buildAxis(const CoverSizer & sizer, DIM_ID axis);
+        /*!
+         * \brief Build the bucket table of one axis
+         */
+        void buildBuckets(DIM_ID axis, int resolution);
+        /*!
+         * \brief Find the range containing the required dimension
+         */
+        const AtlasRun & findRun(DIM_ID axis, int required) const;
+
+    public:
+        /*!
+         * \brief Build the atlas from the generator
+         */
+        bool build(const CoverSizer & sizer, int resolution);
+        /*!
+         * \brief Answer the request without running the generator
+         */
+        bool lookup(const SizingInput & dimensions, SizingResult & result) const;
+        /*!
+         * \brief Write the atlas in the JSON format
+         */
+        void writeJson(std::ostream & stream) const;
+        /*!
+         * \brief Return ranges of the given axis
+         *
+         * \param[in] axis - required dimension (enumeration)
+         * \return Constant reference to the array with ranges
+         */
+        const std::vector<AtlasRun> & returnRuns(DIM_ID axis) const { return this->runs[axis]; }
+        /*!
+         * \brief Return memory used by the tables
+         *
+         * \return Number of bytes of the ranges and buckets
+         */
+        size_t returnBytes() const;
+};
+
+#endif // FEASIBILITYATLAS_HPP
@@ -0,0 +1,113 @@
+#ifndef LATENCYMETER_HPP
+#define LATENCYMETER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class LatencyMeter
+ *
+ * This file contains definition of the class LatencyMeter,
+ * which collects the durations of the generator calls and
+ * checks them against the latency budget.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/*!
+ * \brief Class that implements the latency instrumentation
+ *
+ * LatencyMeter keeps the window of the last samples (fixed size,
+ * no allocation after construction) and counts all samples and the
+ * ones above the budget. Percentiles are calculated from the window
+ * on demand. Samples can be added by many threads.
+ */
+class LatencyMeter
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Last samples in nanoseconds (ring buffer)
+         */
+        std::vector<uint64_t> samples;
+        /*!
+         * \brief Position of the next sample in the ring buffer
+         */
+        size_t next_sample = 0;
+        /*!
+         * \brief Number of all samples
+         */
+        uint64_t count = 0;
+        /*!
+         * \brief Number of samples above the budget
+         */
+        uint64_t over_budget = 0;
+        /*!
+         * \brief Longest sample in nanoseconds
+         */
+        uint64_t max_ns = 0;
+        /*!
+         * \brief Latency budget in nanoseconds (0 - no budget)
+         */
+        uint64_t budget_ns;
+        /*!
+         * \brief Lock of the samples and counters
+         */
+        mutable std::mutex lock;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Default number of samples in the window
+         */
+        static constexpr size_t DefaultWindow = 1024;
+
+    public:
+        /*!
+         * \brief Initialization of the class LatencyMeter
+         */
+        explicit LatencyMeter(uint64_t budget = 0, size_t window = DefaultWindow);
+        /*!
+         * \brief Add the duration of one call
+         */
+        bool addSample(uint64_t duration_ns);
+        /*!
+         * \brief Add the time elapsed since the given moment
+         */
+        bool addSince(std::chrono::steady_clock::time_point start);
+        /*!
+         * \brief Return the percentile of the samples in the window
+         */
+        uint64_t returnPercentile(double fraction) const;
+        /*!
+         * \brief Return the last sample
+         */
+        uint64_t returnLast() const;
+        /*!
+         * \brief Return the longest sample
+         */
+        uint64_t returnMax() const;
+        /*!
+         * \brief Return number of all samples
+         */
+        uint64_t returnCount() const;
+        /*!
+         * \brief Return number of samples above the budget
+         */
+        uint64_t returnOverBudget() const;
+        /*!
+         * \brief Return the latency budget
+         *
+         * \return Budget in nanoseconds (0 - no budget)
+         */
+        uint64_t returnBudget() const { return this->budget_ns; }
+        /*!
+         * \brief Drop all samples and counters
+         */
+        void reset();
+};
+
+#endif // LATENCYMETER_HPP
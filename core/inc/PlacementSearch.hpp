@@ -0,0 +1,39 @@
+#ifndef PLACEMENTSEARCH_HPP
+#define PLACEMENTSEARCH_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class PlacementSearch
+ *
+ * This file contains definition of the class PlacementSearch,
+ * which finds the off-center placement of the device inside
+ * the cover, avoiding the obstacles on the left and right.
+ */
+
+#include "SizingTypes.hpp"
+
+/*!
+ * \brief Class that implements the search of the off-center placement
+ *
+ * Standard cover is centered on the device along the width. If it
+ * hits the obstacle on the left or right, the device can still be
+ * moved inside the cover, as long as the minimal side spaces are
+ * kept on both sides. Every condition (side spaces, obstacle on the
+ * left, obstacle on the right) limits the shift to the interval, so
+ * the search is the intersection of the intervals and the point of
+ * it closest to zero - constant number of operations, no memory is
+ * allocated. Along the depth the device is already placed at the
+ * minimal back space (as close to the wall as allowed), so moving it
+ * to the front would only bring the back of the cover closer to the
+ * obstacle - the back collision is not searched.
+ */
+class PlacementSearch
+{
+    public:
+        /*!
+         * \brief Find the smallest shift of the device, which avoids the obstacles on the sides
+         */
+        static GenErrors placeLength(int device, int inner, int outer, int side_space, int left, int right, int & shift);
+};
+
+#endif // PLACEMENTSEARCH_HPP
@@ -0,0 +1,91 @@
+#ifndef PRODUCTFAMILIES_HPP
+#define PRODUCTFAMILIES_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class ProductFamilies
+ *
+ * This file contains definition of the class ProductFamilies,
+ * which sizes one input against the catalogs of all product
+ * lines (families of the covers) at once.
+ */
+
+#include <string>
+#include <vector>
+#include "CoverSizer.hpp"
+#include "WorkStealingPool.hpp"
+
+/*!
+ * \brief Class that implements the sizing against many product lines
+ *
+ * Every family has its own name and parts library (catalog loaded
+ * by the caller, e.g. one configuration file per product line) and
+ * its own generator. One request is sized against all families and
+ * the result of each one is returned, so it can be seen at once
+ * which families fit the device. Families are sized on the pool in
+ * groups, when the pool is given and there are enough of them to
+ * pay for the tasks (sizing of one family is much shorter than one
+ * task of the pool), otherwise in the calling thread.
+ */
+class ProductFamilies
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Names of the families
+         */
+        std::vector<std::string> names;
+        /*!
+         * \brief Generators of the families (one catalog each)
+         */
+        std::vector<CoverSizer> sizers;
+        /*!
+         * \brief Pool, which sizes the large number of families (optional)
+         */
+        WorkStealingPool *pool;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Number of the families sized by one task of the pool
+         */
+        static constexpr size_t FamiliesPerTask = 256;
+
+    public:
+        /*!
+         * \brief Initialization of the class ProductFamilies
+         */
+        explicit ProductFamilies(WorkStealingPool *workers = nullptr);
+        /*!
+         * \brief Add the family or replace the catalog of the existing one
+         */
+        bool setFamily(const std::string & name, CatalogPtr parts);
+        /*!
+         * \brief Size the cover for every family
+         */
+        size_t generateCovers(const SizingInput & dimensions, std::vector<SizingResult> & results) const;
+        /*!
+         * \brief Return number of the families
+         *
+         * \return Number of the families
+         */
+        size_t returnFamiliesNum() const { return this->names.size(); }
+        /*!
+         * \brief Return name of the family
+         *
+         * \param[in] family_idx - index of the family
+         * \return Constant reference to the name
+         */
+        const std::string & returnName(size_t family_idx) const { return this->names[family_idx]; }
+        /*!
+         * \brief Return generator of the family
+         *
+         * \param[in] family_idx - index of the family
+         * \return Constant reference to the generator
+         */
+        const CoverSizer & returnSizer(size_t family_idx) const { return this->sizers[family_idx]; }
+};
+
+#endif // PRODUCTFAMILIES_HPP
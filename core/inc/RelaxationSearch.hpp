@@ -0,0 +1,106 @@
+#ifndef RELAXATIONSEARCH_HPP
+#define RELAXATIONSEARCH_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class RelaxationSearch
+ *
+ * This file contains definition of the class RelaxationSearch,
+ * which finds the smallest changes of the soft input data (inner
+ * spaces and distances to the obstacles), after which the standard
+ * cover can be generated.
+ */
+
+#include "CoverSizer.hpp"
+
+/*!
+ * \brief Soft input data, which can be changed by the user
+ */
+enum SOFT_INPUT
+{
+    SIDE_SPACE,     /*! Inner space on the sides */
+    FRONT_SPACE,    /*! Inner space in the front */
+    BACK_SPACE,     /*! Inner space in the back */
+    TOP_SPACE,      /*! Inner space on the top */
+    LEFT_OBSTACLE,  /*! Distance to the obstacle on the left */
+    RIGHT_OBSTACLE, /*! Distance to the obstacle on the right */
+    BACK_OBSTACLE   /*! Distance to the obstacle on the back */
+};
+/*!
+ * \brief Number of the soft input data
+ */
+static constexpr int SoftInputsNum = 7;
+/*!
+ * \brief Change of one soft input data
+ */
+struct InputChange
+{
+    /*! Changed input data */
+    SOFT_INPUT input = SIDE_SPACE;
+    /*! Value given by the user (with resolved default spaces) */
+    int from = 0;
+    /*! Suggested value */
+    int to = 0;
+};
+/*!
+ * \brief Suggestion of the changes, after which the standard cover can be generated
+ */
+struct RelaxationResult
+{
+    /*! Suggested changes (in the order of SOFT_INPUT) */
+    InputChange changes[SoftInputsNum];
+    /*! Number of the suggested changes */
+    uint8_t changes_num = 0;
+    /*! Number of the generations run by the search */
+    uint16_t evaluations = 0;
+    /*! Result of the generator after the changes */
+    SizingResult result;
+};
+
+/*!
+ * \brief Class that implements the search of the nearest feasible input data
+ *
+ * Soft input data only helps the cover if it is loosened - smaller
+ * inner spaces give smaller cover and more distant obstacles cannot
+ * be hit. At first every soft value is loosened as much as allowed
+ * (spaces to the minimal recommended ones of the catalog, obstacles
+ * far away). If the cover cannot be generated even then, the device
+ * itself needs the special cover. Otherwise, the values are brought
+ * back to the data of the user one by one (obstacles first, since
+ * moving the device is harder than changing the spaces), each with the
+ * binary search of the value closest to the user one, which still
+ * gives the standard cover. Every tested value is sized by CoverSizer
+ * (index of the catalog), so the number of generations is bounded by
+ * a few hundred and no memory is allocated.
+ */
+class RelaxationSearch
+{
+    private:
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Distance to the obstacle, which cannot collide with any cover [mm]
+         */
+        static constexpr int FarObstacle = 10000;
+        /*!
+         * \brief Order, in which the values are brought back to the data of the user
+         */
+        static constexpr SOFT_INPUT RestoreOrder[SoftInputsNum] = { LEFT_OBSTACLE, RIGHT_OBSTACLE, BACK_OBSTACLE,
+                                                                    TOP_SPACE, BACK_SPACE, FRONT_SPACE, SIDE_SPACE };
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Return the reference to the soft input data
+         */
+        static int & softValue(SizingInput & input, SOFT_INPUT soft_input);
+
+    public:
+        /*!
+         * \brief Find the smallest changes of the soft input data giving the standard cover
+         */
+        static bool findNearestFeasible(const CoverSizer & sizer, const SizingInput & dimensions, RelaxationResult & relaxation);
+};
+
+#endif // RELAXATIONSEARCH_HPP
@@ -0,0 +1,171 @@
+#ifndef ROWLAYOUTSOLVER_HPP
+#define ROWLAYOUTSOLVER_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class RowLayoutSolver
+ *
+ * This file contains definition of the class RowLayoutSolver,
+ * which covers the row of heat pumps standing side by side
+ * against the wall with the standard covers (shared or individual).
+ */
+
+#include <vector>
+#include "CoverOptimizer.hpp"
+
+/*!
+ * \brief One heat pump of the row (from left to right)
+ */
+struct RowUnit
+{
+    /*! Dimensions of the heat pump (width, depth, height) */
+    int device[DimNum] = {0, 0, 0};
+    /*! Inner spaces of the cover (sides, front, back, top; -1 - default) */
+    int spaces[DevSides] = {-1, -1, -1, -1};
+    /*! Distance to the previous heat pump (to the left end of the wall for the first one) */
+    int gap = 0;
+};
+/*!
+ * \brief Site of the row
+ */
+struct RowSite
+{
+    /*! Heat pumps from left to right */
+    std::vector<RowUnit> units;
+    /*! Length of the wall available for the covers (ends are the obstacles) */
+    int wall_length = 0;
+    /*! Distance from the heat pumps to the wall behind them (-1 - not given) */
+    int back_distance = -1;
+};
+/*!
+ * \brief One cover of the layout
+ */
+struct RowCover
+{
+    /*! Index of the first heat pump under the cover */
+    uint8_t first_unit = 0;
+    /*! Number of the heat pumps under the cover */
+    uint8_t units_num = 0;
+    /*! Result of the generator for the cover */
+    SizingResult result;
+};
+/*!
+ * \brief Best layout of the row
+ */
+struct RowLayout
+{
+    /*! Covers from left to right (empty if there is no layout of the standard covers) */
+    std::vector<RowCover> covers;
+    /*! Sum of the ranking criterion of all covers (lower is better) */
+    uint64_t score = 0;
+    /*! Number of the generated covers (with obstacles) during the search */
+    uint32_t evaluations = 0;
+    /*! Duration of the search in seconds */
+    double seconds = 0.0;
+};
+
+/*!
+ * \brief Class that implements the layout of the covers for the row of heat pumps
+ *
+ * Every group of the neighbouring heat pumps can get its own cover.
+ * Group is sized by CoverSizer as one device spanning from the left side
+ * of the first heat pump to the right side of the last one (the largest
+ * depth and height, the spaces of all heat pumps kept), so the obstacle
+ * logic of the generator applies without changes: the ends of the wall,
+ * the wall behind and the neighbouring covers are the obstacles. Cover
+ * reaches beyond its heat pumps by the overhang, thus the distance to
+ * the obstacle on the left is the gap to the previous heat pump minus
+ * the overhang of the previous cover. Layout with the lowest sum of the
+ * criterion (fewer covers for the equal sums) is searched by the branch
+ * and bound: the best layout of the rest of the row depends only on the
+ * first heat pump and the overhang on the left, so it is computed once
+ * and remembered, and groups, which cannot beat the best layout of
+ * the rest even with the lower bound of the remaining heat pumps, are
+ * skipped. Every choice of the first group is searched by the separate
+ * task of the work-stealing pool.
+ */
+class RowLayoutSolver
+{
+    private:
+
+        /*!
+         * \brief Best layout of the rest of the row (remembered)
+         */
+        struct SubLayout
+        {
+            /*! Sum of the criterion */
+            uint64_t score = 0;
+            /*! Number of the covers */
+            uint8_t covers_num = 0;
+            /*! Index of the last heat pump of the first group (-1 - end of the row) */
+            int8_t group_end = -1;
+            /*! Layout of the standard covers exists */
+            bool feasible = false;
+        };
+        /*!
+         * \brief State of one task of the search
+         */
+        struct SearchTask;
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Generator of the groups
+         */
+        CoverSizer sizer;
+        /*!
+         * \brief Pool, which runs the search
+         */
+        WorkStealingPool & pool;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Maximum number of the heat pumps in the row
+         */
+        static constexpr size_t MaxRowUnits = 64;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Find the best layout of the rest of the row
+         */
+        SubLayout solveRest(SearchTask & task, int first, int overhang) const;
+        /*!
+         * \brief Return the value of the criterion for the cover
+         */
+        static uint64_t returnScore(const SizingResult & result, OptimizerGoal goal);
+
+    public:
+        /*!
+         * \brief Initialization of the class RowLayoutSolver
+         */
+        RowLayoutSolver(CatalogPtr parts, WorkStealingPool & workers);
+        /*!
+         * \brief Find the best layout of the standard covers for the row
+         */
+        bool solve(const RowSite & site, OptimizerGoal goal, RowLayout & layout) const;
+        /*!
+         * \brief Size the cover of the group of the heat pumps
+         */
+        bool sizeGroup(const RowSite & site, int first, int last, int overhang, SizingResult & result) const;
+        /*!
+         * \brief Check if the site can be laid out (heat pumps within the wall)
+         */
+        static bool isValid(const RowSite & site);
+        /*!
+         * \brief Return the length, by which the cover reaches beyond its heat pumps on each side
+         *
+         * Halves are calculated with the integer division, as in the
+         * collision check of the generator.
+         *
+         * \param[in] result - result of the generator for the group
+         * \return Overhang in mm
+         */
+        static int returnOverhang(const SizingResult & result)
+        {
+            return result.outer_dim[DIM_ID::LENGTH] / 2 - result.input.device[DIM_ID::LENGTH] / 2;
+        }
+};
+
+#endif // ROWLAYOUTSOLVER_HPP
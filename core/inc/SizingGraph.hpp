@@ -0,0 +1,100 @@
+#ifndef SIZINGGRAPH_HPP
+#define SIZINGGRAPH_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class SizingGraph and structure SizingState
+ *
+ * This file contains definition of the dependency graph of the
+ * generator (which input data feed which derived values) and of
+ * the state kept between the incremental generations.
+ */
+
+#include "CoverCatalog.hpp"
+
+/*!
+ * \brief Number of the input values of the generator (device, obstacles, spaces)
+ */
+static constexpr uint8_t SizingInputsNum = 2 * DimNum + DevSides;
+/*!
+ * \brief Derived values of the generator (nodes of the dependency graph)
+ *
+ * Order of the enumeration is the topological order of the
+ * graph - every node depends only on the nodes before it.
+ */
+enum SIZING_NODE
+{
+    INNER_LENGTH,    /*! Required width and its limit */
+    INNER_WIDTH,     /*! Required depth and its limit */
+    INNER_HEIGHT,    /*! Required height and its limit */
+    PART_LENGTH,     /*! Part for the required width */
+    PART_WIDTH,      /*! Part for the required depth */
+    PART_HEIGHT,     /*! Number of the wall modules for the required height */
+    OUTER_LENGTH,    /*! Outer width of the cover */
+    OUTER_WIDTH,     /*! Outer depth of the cover */
+    OUTER_HEIGHT,    /*! Outer height of the cover */
+    LEFT_CHECK,      /*! Collision with the obstacle on the left */
+    RIGHT_CHECK,     /*! Collision with the obstacle on the right */
+    BACK_CHECK       /*! Collision with the obstacle on the back */
+};
+/*!
+ * \brief Number of the nodes of the dependency graph
+ */
+static constexpr uint8_t SizingNodesNum = 12;
+/*!
+ * \brief State of the incremental generation
+ *
+ * Keeps the values of all nodes of the dependency graph computed
+ * without the early exits of the full generation, so every node
+ * can be reused after any change of the input data. Owned by the
+ * caller (one per sequence of the similar requests, e.g. per
+ * live preview or per sweep), like SizingResult.
+ */
+struct SizingState
+{
+    /*! Catalog used for the values below (empty - nothing computed yet) */
+    CatalogPtr catalog;
+    /*! Values of the nodes (input with resolved spaces, dimensions) */
+    SizingResult values;
+    /*! Required dimensions within the limits */
+    bool dim_correct[DimNum] = {false, false, false};
+    /*! Found parts (width and depth) and modules on each wall, -1 if not found */
+    int found_parts[DimNum] = {-1, -1, -1};
+    /*! No collision with the obstacles (left, right, back) */
+    bool no_collision[DimNum] = {true, true, true};
+    /*! Nodes computed in the last generation (bit mask) */
+    uint16_t recomputed = 0;
+    /*! Result built from the values of the nodes */
+    SizingResult result;
+};
+/*!
+ * \brief Class that describes the dependency graph of the generator
+ *
+ * Every node depends on some of the input values and on some of
+ * the previous nodes. SizingGraph finds the input values changed
+ * between two requests and all nodes, which have to be computed
+ * again (changed inputs with everything that depends on them).
+ * Nodes affected by each input value are found at compile time.
+ */
+class SizingGraph
+{
+    public:
+        /*!
+         * \brief Mask of all nodes of the graph
+         */
+        static constexpr uint16_t AllNodes = (1 << SizingNodesNum) - 1;
+        /*!
+         * \brief Return the input value with the given index
+         */
+        static int returnInput(const SizingInput & input, uint8_t input_idx);
+        /*!
+         * \brief Find the input values changed between two requests
+         */
+        static uint16_t changedInputs(const SizingInput & previous, const SizingInput & current);
+        /*!
+         * \brief Find the nodes, which have to be computed again
+         */
+        static uint16_t dirtyNodes(uint16_t changed_inputs);
+};
+
+#endif // SIZINGGRAPH_HPP
@@ -0,0 +1,125 @@
+#ifndef SIZINGKERNEL_HPP
+#define SIZINGKERNEL_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class SizingKernel
+ *
+ * This file contains definition of the class SizingKernel,
+ * which sizes the batch of covers with the vectorized code
+ * (SSE4.2 / AVX2 on x86, SIMD128 in the WASM build) selected
+ * at runtime. Kernels use the lookup tables of CatalogIndex.
+ */
+
+#include "BatchInputs.hpp"
+#include "CoverCatalog.hpp"
+#include "PlacementSearch.hpp"
+
+/*!
+ * \brief Instruction sets supported by the kernel
+ */
+enum KernelIsa
+{
+    ISA_SCALAR,  /*! Plain C++ (one item at a time) */
+    ISA_SSE42,   /*! SSE4.2 (4 items at a time) */
+    ISA_AVX2,    /*! AVX2 (8 items at a time) */
+    ISA_WASM128  /*! WebAssembly SIMD128 (4 items at a time) */
+};
+/*!
+ * \brief Class that implements the vectorized sizing kernel
+ *
+ * SizingKernel keeps the index of the catalog (built once, when
+ * the catalog has been loaded) and sizes the batches with the widest instruction set available
+ * on the current CPU. Items that do not fill the whole vector
+ * are sized with the scalar code. Results are identical to the
+ * ones of CoverSizer for every instruction set. If the caller
+ * provides the array of shifts, items colliding on the left or
+ * right are placed off-center afterwards (CoverSizer::placeOffCenter).
+ * If it provides the array of orientations, the rotated devices are
+ * sized by the same kernel and the better orientation is kept
+ * (CoverSizer::exploreRotation).
+ */
+class SizingKernel
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Index of the parts library
+         */
+        CatalogIndex index;
+        /*!
+         * \brief Instruction set used by the kernel
+         */
+        KernelIsa isa = ISA_SCALAR;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Number of the rotated devices sized at once (buffers on the stack)
+         */
+        static constexpr size_t RotationChunk = 256;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Size the covers of the items in the typed orientation
+         */
+        void sizeOrientation(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const;
+        /*!
+         * \brief Size the rotated devices and keep the better orientation of every item
+         */
+        void sizeRotated(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const;
+
+    public:
+        /*!
+         * \brief Initialization of the class SizingKernel with the given parts library
+         */
+        explicit SizingKernel(const CoverCatalog & parts);
+        /*!
+         * \brief Find the widest instruction set supported by the current CPU
+         */
+        static KernelIsa detectIsa();
+        /*!
+         * \brief Return the name of the instruction set
+         */
+        static const char * isaName(KernelIsa kernel_isa);
+        /*!
+         * \brief Force the instruction set (if supported)
+         */
+        bool setIsa(KernelIsa kernel_isa);
+        /*!
+         * \brief Return the instruction set used by the kernel
+         *
+         * \return Instruction set (enumeration)
+         */
+        KernelIsa returnIsa() const { return this->isa; }
+        /*!
+         * \brief Size the covers for all items of the batch
+         */
+        size_t sizeBatch(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const;
+};
+
+/*!
+ * \brief Size the items [begin, end) of the batch one by one
+ */
+void sizeBatchScalar(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t begin, size_t end);
+/*!
+ * \brief Move the devices of the items [begin, end) colliding on the left or right inside the covers
+ */
+void placeBatchScalar(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t begin, size_t end);
+/*!
+ * \brief Size the items of the batch 4 at a time with SSE4.2 (returns number of sized items)
+ */
+size_t sizeBatchSse42(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count);
+/*!
+ * \brief Size the items of the batch 8 at a time with AVX2 (returns number of sized items)
+ */
+size_t sizeBatchAvx2(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count);
+/*!
+ * \brief Size the items of the batch 4 at a time with WASM SIMD128 (returns number of sized items)
+ */
+size_t sizeBatchWasm128(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count);
+
+#endif // SIZINGKERNEL_HPP
@@ -0,0 +1,51 @@
+#ifndef SIZINGMESSAGES_HPP
+#define SIZINGMESSAGES_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class SizingMessages
+ *
+ * This file contains definition of the class SizingMessages,
+ * which maps the error codes of the sizing core to the text
+ * messages provided by the caller.
+ */
+
+#include <string>
+#include <vector>
+#include "SizingTypes.hpp"
+
+/*!
+ * \brief Class that implements the table of the generator messages
+ *
+ * The sizing core reports only error codes (GenErrors).
+ * SizingMessages lets the headless tools translate those
+ * codes to the same texts, which are displayed by the GUI.
+ * Contents of the messages file is loaded by the caller.
+ */
+class SizingMessages
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Array with the generator error messages
+         */
+        std::vector<std::string> gen_error_msgs;
+        /*!
+         * \brief Message returned for the codes without the text
+         */
+        std::string empty_msg;
+
+    public:
+        /*!
+         * \brief Load the error messages from the contents of the messages file
+         */
+        bool readMessages(const std::string & contents);
+        /*!
+         * \brief Return the message of the given error
+         */
+        const std::string & returnMessage(GenErrors error) const;
+};
+
+#endif // SIZINGMESSAGES_HPP
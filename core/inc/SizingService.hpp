@@ -0,0 +1,115 @@
+#ifndef SIZINGSERVICE_HPP
+#define SIZINGSERVICE_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class SizingService
+ *
+ * This file contains definition of the class SizingService,
+ * which answers the JSON requests of the sizing service (single
+ * quote and batch) with one catalog shared by all threads.
+ */
+
+#include <string>
+#include "BulkSizer.hpp"
+#include "CoverSizer.hpp"
+#include "LatencyMeter.hpp"
+#include "SizingMessages.hpp"
+
+/*!
+ * \brief Class that implements the JSON sizing service
+ *
+ * SizingService is independent of the transport (HTTP server of
+ * hpsizing_server, tests). Quote is one object with the arrays of the
+ * input data, the same as the steps of the GUI:
+ * {"device":[width,depth,height],"obstacles":[left,right,back],"spaces":[sides,front,back,top]}
+ * Obstacles and spaces are optional, null or -1 means the data not
+ * given. Batch is the array of such objects, sized by BatchSizer at
+ * once. Answer has the status (name of GenErrors), the message of the
+ * GUI (if loaded), the dimensions and the number of modules. Generators
+ * are reentrant and the catalog is constant, so any number of threads
+ * can call the service at the same time. Duration of every request is
+ * added to the latency counters of its endpoint.
+ */
+class SizingService
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Generator of the single quotes
+         */
+        CoverSizer sizer;
+        /*!
+         * \brief Generator of the batches
+         */
+        BatchSizer batch;
+        /*!
+         * \brief Messages of the errors (the same as in the GUI)
+         */
+        SizingMessages messages;
+        /*!
+         * \brief Durations of the single quotes
+         */
+        LatencyMeter quote_latency;
+        /*!
+         * \brief Durations of the batches
+         */
+        LatencyMeter batch_latency;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Maximum number of the items in one batch
+         */
+        static constexpr size_t MaxBatchItems = 10000;
+        /*!
+         * \brief Number of the samples in the window of the latency counters
+         */
+        static constexpr size_t LatencyWindow = 65536;
+        /*!
+         * \brief Largest value accepted by the GUI (DimInput)
+         */
+        static constexpr int MaxDimension = 2000;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Read one quote (object with the arrays of the input data)
+         */
+        static bool parseQuote(const char *& position, const char *end, SizingInput & input);
+        /*!
+         * \brief Append the answer for one quote
+         */
+        void formatAnswer(GenErrors error, const uint16_t inner[DimNum], const uint16_t outer[DimNum],
+                          uint8_t modules, std::string & response) const;
+        /*!
+         * \brief Append the counters of one endpoint
+         */
+        static void formatLatency(const char *name, const LatencyMeter & meter, std::string & response);
+
+    public:
+        /*!
+         * \brief Initialization of the class SizingService with the given parts library
+         */
+        explicit SizingService(CatalogPtr parts);
+        /*!
+         * \brief Load the error messages from the contents of the messages file
+         */
+        bool setMessages(const std::string & contents);
+        /*!
+         * \brief Answer the single quote
+         */
+        int answerQuote(const char *body, size_t length, std::string & response);
+        /*!
+         * \brief Answer the batch of quotes
+         */
+        int answerBatch(const char *body, size_t length, std::string & response);
+        /*!
+         * \brief Write the latency counters of all endpoints
+         */
+        void answerStats(std::string & response) const;
+};
+
+#endif // SIZINGSERVICE_HPP
@@ -0,0 +1,190 @@
+#ifndef SIZINGTYPES_HPP
+#define SIZINGTYPES_HPP
+
+/*!
+ * \file
+ * \brief Basic types shared by the sizing core
+ *
+ * This file contains the constants, enumerations and
+ * plain structures used by the Qt-free sizing engine
+ * (inputs, results and error codes). It is included
+ * by both the GUI and the headless tools. Dimensions of the
+ * catalog are kept in the fixed-point format (tenths of the
+ * millimetre), so the engine does not use floating point.
+ */
+
+#include <cstdint>
+
+/*!
+ * \brief Number of considered sides of the heat pump
+ */
+static constexpr uint8_t DevSides = 4;
+/*!
+ * \brief Number of considered dimensions
+ */
+static constexpr uint8_t DimNum = 3;
+/*!
+ * \brief Maximum number of standard modules on each wall (max height)
+ */
+static constexpr uint8_t MaxWallModules = 3;
+/*!
+ * \brief Dimension in the fixed-point format (tenths of the millimetre)
+ */
+typedef int32_t FixedDim;
+/*!
+ * \brief Number of the fixed-point units in one millimetre
+ */
+static constexpr FixedDim FixedScale = 10;
+/*!
+ * \brief Convert millimetres to the fixed-point format (exact)
+ *
+ * \param[in] millimetres - dimension in millimetres
+ * \return Dimension in tenths of the millimetre
+ */
+static constexpr FixedDim toFixed(int millimetres)
+{
+    return millimetres * FixedScale;
+}
+/*!
+ * \brief Convert the fixed-point dimension to millimetres (rounded toward zero)
+ *
+ * Gives the same value as the conversion of the decimal number
+ * to the integer in the original generator (static_cast).
+ *
+ * \param[in] value - dimension in tenths of the millimetre
+ * \return Dimension in millimetres
+ */
+static constexpr int truncToMm(FixedDim value)
+{
+    return value / FixedScale;
+}
+/*!
+ * \brief Convert the fixed-point dimension to millimetres (rounded down)
+ *
+ * \param[in] value - dimension in tenths of the millimetre
+ * \return Dimension in millimetres
+ */
+static constexpr int floorToMm(FixedDim value)
+{
+    return (value % FixedScale < 0) ? value / FixedScale - 1 : value / FixedScale;
+}
+/*!
+ * \brief Identification of the dimension in the arrays
+ */
+enum DIM_ID
+{
+    LENGTH, /*! Width */
+    WIDTH,  /*! Depth */
+    HEIGHT  /*! Height */
+};
+/*!
+ * \brief Criterion of the choice of the wall modules stack
+ */
+enum StackGoal
+{
+    MIN_STACK_HEIGHT, /*! Lowest stack (then the smallest number of modules) */
+    MIN_STACK_PARTS   /*! Smallest number of modules (then the lowest stack) */
+};
+/*!
+ * \brief Errors of the generator
+ *
+ * Values are used as indices in the tables with the
+ * error messages, so the order has to match the
+ * message files. COVER_OK is not a message, it only
+ * marks the successfully generated cover.
+ */
+enum GenErrors
+{
+    LEFT_COLLISION,  /*! Collision with the obstacle on the left */
+    RIGHT_COLLISION, /*! Collision with the obstacle on the right */
+    BACK_COLLISION,  /*! Collision with hthe obstacle on the back */
+    TOO_LONG,        /*! Desired cover is too wide */
+    TOO_WIDE,        /*! Desired cover is too deep */
+    TOO_HIGH,        /*! Desired cover is too high */
+    NO_PART_WIDTH,   /*! No part for the desired depth */
+    NO_PART_LENGTH,  /*! No part for the desired width */
+    COVER_OK         /*! Cover generated without errors */
+};
+/*!
+ * \brief Number of possible errors of the generator
+ */
+static constexpr int GenErrorsNum = 8;
+/*!
+ * \brief Size of the cover (images of the result window)
+ */
+enum COVER_SIZE
+{
+    SIZE_S,  /*! No wall modules */
+    SIZE_M,  /*! Stack as high as one standard module on each wall */
+    SIZE_L,  /*! Stack as high as two standard modules on each wall */
+    SIZE_XL  /*! Stack as high as three (or more) standard modules on each wall */
+};
+/*!
+ * \brief Number of the sizes of the cover
+ */
+static constexpr uint8_t CoverSizesNum = 4;
+/*!
+ * \brief Check if the cover of the rotated device is better than the one of the typed orientation
+ *
+ * Only the standard cover can be better. If both orientations fit,
+ * the smaller footprint wins (height does not depend on the
+ * orientation) and the typed orientation is kept at equal ones.
+ *
+ * \param[in] typed_error - error of the typed orientation
+ * \param[in] typed_footprint - outer width x depth of the typed orientation
+ * \param[in] rotated_error - error of the rotated device
+ * \param[in] rotated_footprint - outer width x depth of the rotated device
+ * \return True if the rotated device should be used
+ */
+static constexpr bool isRotationBetter(GenErrors typed_error, uint32_t typed_footprint,
+                                       GenErrors rotated_error, uint32_t rotated_footprint)
+{
+    return rotated_error == GenErrors::COVER_OK &&
+           (typed_error != GenErrors::COVER_OK || rotated_footprint < typed_footprint);
+}
+/*!
+ * \brief Input data of the generator
+ *
+ * Rows correspond to the steps of the generator. Value -1
+ * means that the data has not been given by the user (no
+ * obstacle or default inner space).
+ */
+struct SizingInput
+{
+    /*! Dimensions of the heat pump (width, depth, height) */
+    int device[DimNum];
+    /*! Distances to the obstacles (left, right, back) */
+    int obstacles[DimNum];
+    /*! Inner spaces of the cover (sides, front, back, top) */
+    int spaces[DevSides];
+};
+/*!
+ * \brief Result of the generator for one request
+ *
+ * Plain value type, which keeps the whole state of one
+ * generation, so it can live on the stack of the caller
+ * and many requests can be sized at the same time. The
+ * dimensions and the number of modules are valid only if
+ * the error is COVER_OK.
+ */
+struct SizingResult
+{
+    /*! Data from the user (with resolved default spaces) */
+    SizingInput input;
+    /*! Minimal necessary inner dimensions of the cover */
+    uint16_t approx_inner_dim[DimNum] = {0, 0, 0};
+    /*! Inner dimensions of the generated cover */
+    uint16_t inner_dim[DimNum] = {0, 0, 0};
+    /*! Outer dimensions of the generated cover */
+    uint16_t outer_dim[DimNum] = {0, 0, 0};
+    /*! Number of wall modules (size of the standard cover) */
+    uint8_t modules = 0;
+    /*! Shift of the device from the center of the cover to the right (off-center placement only) */
+    int16_t shift = 0;
+    /*! Device rotated by 90 degrees - width and depth swapped in the input (orientation search only) */
+    bool rotated = false;
+    /*! Error raised during the generation */
+    GenErrors error = GenErrors::COVER_OK;
+};
+
+#endif // SIZINGTYPES_HPP
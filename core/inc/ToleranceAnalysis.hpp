@@ -0,0 +1,144 @@
+#ifndef TOLERANCEANALYSIS_HPP
+#define TOLERANCEANALYSIS_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class ToleranceAnalysis
+ *
+ * This file contains definition of the class ToleranceAnalysis,
+ * which estimates the probability of each result of the generator,
+ * when the measurements typed by the user are not exact.
+ */
+
+#include "BatchSizer.hpp"
+#include "CoverSizer.hpp"
+#include "WorkStealingPool.hpp"
+
+/*!
+ * \brief Distribution of the error of one input value
+ */
+enum ToleranceDistribution
+{
+    TOLERANCE_NONE,    /*! Value is exact */
+    TOLERANCE_UNIFORM, /*! Uniform error from -spread to +spread */
+    TOLERANCE_NORMAL   /*! Normal error with the standard deviation equal to spread */
+};
+/*!
+ * \brief Error of one input value
+ */
+struct InputTolerance
+{
+    /*! Distribution of the error */
+    ToleranceDistribution distribution = TOLERANCE_NONE;
+    /*! Largest error (uniform) or standard deviation (normal) in mm */
+    int spread = 0;
+};
+/*!
+ * \brief Settings of the analysis
+ */
+struct ToleranceSettings
+{
+    /*! Errors of the input values (device, obstacles, spaces - order of SizingInput) */
+    InputTolerance inputs[SizingInputsNum];
+    /*! Number of the sampled inputs */
+    uint32_t samples = 20000;
+    /*! Seed of the samples (the same seed gives the same result on every platform) */
+    uint64_t seed = 1;
+};
+/*!
+ * \brief Result of the analysis
+ */
+struct ToleranceResult
+{
+    /*! Result of the generator for the typed data */
+    SizingResult nominal;
+    /*! Number of the sampled inputs */
+    uint32_t samples = 0;
+    /*! Number of the samples with the given result (index - GenErrors) */
+    uint32_t errors[GenErrors::COVER_OK + 1] = {};
+    /*! Number of the standard covers of the given size (index - COVER_SIZE) */
+    uint32_t sizes[CoverSizesNum] = {};
+    /*! Number of the samples with the same result as the typed data (error and size) */
+    uint32_t nominal_count = 0;
+    /*! Duration of the analysis in seconds */
+    double seconds = 0.0;
+};
+
+/*!
+ * \brief Class that implements the tolerance analysis of the input data
+ *
+ * Site measurements are often not exact, while the generator gives
+ * the answer for the single point. ToleranceAnalysis samples the input
+ * data with the error of every value drawn from its own distribution
+ * (data not given by the user is never changed and sampled values are
+ * not negative), sizes all samples with BatchSizer in the tasks of the
+ * work-stealing pool and counts the results: every GenErrors value and
+ * the size of the standard cover (S, M, L, XL - see CatalogIndex). Samples are drawn by
+ * the integer generator seeded per block, so the result depends only
+ * on the settings (not on the number of threads or the platform).
+ */
+class ToleranceAnalysis
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Generator of the typed data
+         */
+        CoverSizer sizer;
+        /*!
+         * \brief Batch generator of the samples
+         */
+        BatchSizer batch;
+        /*!
+         * \brief Pool, which sizes the samples
+         */
+        WorkStealingPool & pool;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Number of the samples of one task
+         */
+        static constexpr uint32_t BlockSamples = 2048;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Draw, size and count one block of the samples
+         */
+        void sizeBlock(const SizingInput & dimensions, const SizingResult & nominal,
+                       const ToleranceSettings & settings, uint32_t block, ToleranceResult & counts) const;
+        /*!
+         * \brief Draw the error of one input value
+         */
+        static int drawError(uint64_t & state, const InputTolerance & tolerance);
+
+    public:
+        /*!
+         * \brief Initialization of the class ToleranceAnalysis
+         */
+        ToleranceAnalysis(CatalogPtr parts, WorkStealingPool & workers);
+        /*!
+         * \brief Estimate the probability of each result for the inaccurate input data
+         */
+        void analyze(const SizingInput & dimensions, const ToleranceSettings & settings, ToleranceResult & result) const;
+        /*!
+         * \brief Return the settings with the same error of all measured values
+         */
+        static ToleranceSettings returnMeasurementSettings(ToleranceDistribution distribution, int spread);
+        /*!
+         * \brief Return the share of the samples (0 - 1)
+         *
+         * \param[in] result - result of the analysis
+         * \param[in] count - number of the samples
+         * \return Share of the samples
+         */
+        static double returnShare(const ToleranceResult & result, uint32_t count)
+        {
+            return (result.samples > 0) ? static_cast<double>(count) / result.samples : 0.0;
+        }
+};
+
+#endif // TOLERANCEANALYSIS_HPP
@@ -0,0 +1,140 @@
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class WorkStealingPool
+ *
+ * This file contains definition of the class WorkStealingPool,
+ * which runs the small tasks of the sizing core (e.g. search of
+ * the optimal cover) on all hardware threads.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief Class that implements the pool of threads with the work stealing
+ *
+ * Every worker has its own queue of tasks. New tasks are spread
+ * over the queues in turns. Worker takes the newest task from its
+ * own queue and, if the queue is empty, steals the oldest task from
+ * the queues of the other workers, so the uneven tasks are balanced
+ * automatically. Threads are started once and wait for the tasks,
+ * thus the pool can be used by the interactive code. parallelFor
+ * splits the indices into few chunks, the waiting thread runs the
+ * tasks too and sleeps only if there is nothing left to run.
+ */
+class WorkStealingPool
+{
+    private:
+
+        /*!
+         * \brief Queue of the tasks owned by one worker
+         */
+        struct WorkerQueue
+        {
+            /*! Lock of the queue */
+            std::mutex lock;
+            /*! Waiting tasks */
+            std::deque<std::function<void()>> tasks;
+        };
+        /*!
+         * \brief State of one call of parallelFor shared with its tasks
+         */
+        struct ForState
+        {
+            /*! Number of the chunks, which are not done yet */
+            std::atomic<size_t> remaining;
+            /*! Lock used only to wait for the last chunk */
+            std::mutex lock;
+            /*! Notification about the last chunk */
+            std::condition_variable done;
+        };
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Queues of the workers
+         */
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        /*!
+         * \brief Threads of the workers
+         */
+        std::vector<std::thread> workers;
+        /*!
+         * \brief Lock used only to wait for the new tasks
+         */
+        std::mutex wake_lock;
+        /*!
+         * \brief Notification about the new tasks or the end of work
+         */
+        std::condition_variable wake;
+        /*!
+         * \brief Number of the tasks waiting in all queues
+         */
+        std::atomic<size_t> pending;
+        /*!
+         * \brief Queue, which receives the next task
+         */
+        std::atomic<size_t> next_queue;
+        /*!
+         * \brief True if the workers have to finish
+         */
+        bool stopping = false;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Number of the chunks of parallelFor for every worker
+         */
+        static constexpr size_t ChunksPerWorker = 4;
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Take the task from the given queue or steal it from the others
+         */
+        bool takeTask(size_t queue_idx, std::function<void()> & task);
+        /*!
+         * \brief Main loop of the worker
+         */
+        void workerLoop(size_t queue_idx);
+
+    public:
+        /*!
+         * \brief Initialization of the class WorkStealingPool
+         */
+        explicit WorkStealingPool(unsigned threads_num = 0);
+        /*!
+         * \brief Stop and join all workers
+         */
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool & operator=(const WorkStealingPool &) = delete;
+
+        /*!
+         * \brief Add the task to the pool
+         */
+        void submit(std::function<void()> task);
+        /*!
+         * \brief Run the body for every index [0, count) and wait for the end
+         */
+        void parallelFor(size_t count, const std::function<void(size_t)> & body);
+        /*!
+         * \brief Return number of the worker threads
+         *
+         * \return Number of the threads
+         */
+        size_t returnThreadsNum() const { return this->workers.size(); }
+};
+
+#endif // WORKSTEALINGPOOL_HPP
@@ -0,0 +1,23 @@
+#include "BatchSizer.hpp"
+
+/*!
+ * \brief Initialization of the class BatchSizer with the given parts library
+ *
+ * \param[in] parts - parts library loaded by the caller
+ */
+BatchSizer::BatchSizer(const CoverCatalog & parts) : kernel(parts)
+{
+
+}
+/*!
+ * \brief Size the covers for all items of the batch
+ *
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of the standard covers generated in the batch
+ */
+size_t BatchSizer::sizeBatch(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const
+{
+    return kernel.sizeBatch(inputs, outputs, count);
+}
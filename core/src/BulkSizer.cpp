@@ -0,0 +1,390 @@
+#include "BulkSizer.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+
+/*!
+ * \brief Initialization of the class BulkSizer with the given parts library
+ *
+ * Ring has two blocks per thread of the pool (one sized, one waiting)
+ * and two more for the reading and writing thread.
+ *
+ * \param[in] parts - parts library loaded by the caller
+ * \param[in] workers - pool, which sizes the blocks (shared with other users)
+ * \param[in] block_bytes - size of the block read at once
+ */
+BulkSizer::BulkSizer(const CoverCatalog & parts, WorkStealingPool & workers, size_t block_bytes) :
+    batch(parts), pool(workers), chunk_bytes(block_bytes)
+{
+    size_t chunks_num = 2 * pool.returnThreadsNum() + 2;
+
+    for(size_t i = 0; i < chunks_num; ++i)
+        chunks.push_back(std::make_unique<BulkChunk>());
+}
+/*!
+ * \brief Return the name of the error code used in the results
+ *
+ * \param[in] error - error code (GenErrors or the invalid row)
+ * \return Constant string with the name
+ */
+const char * BulkSizer::statusName(uint8_t error)
+{
+    static constexpr char const *Names[GenErrors::COVER_OK + 2] = { "LEFT_COLLISION", "RIGHT_COLLISION", "BACK_COLLISION",
+                                                                    "TOO_LONG", "TOO_WIDE", "TOO_HIGH", "NO_PART_WIDTH",
+                                                                    "NO_PART_LENGTH", "COVER_OK", "INVALID_ROW" };
+
+    return (error <= InvalidRow) ? Names[error] : Names[InvalidRow];
+}
+/*!
+ * \brief Read the values of one row
+ *
+ * Values are separated by commas or semicolons (spreadsheets with the
+ * decimal comma), spaces and tabs around them are skipped. Empty value
+ * means the data not given (-1). Values have to be the same as the ones
+ * accepted by the GUI (integer from 0 to MaxDimension - 1), the device
+ * has to be given.
+ *
+ * \param[in] begin - first character of the row
+ * \param[in] end - character after the last one of the row (without the new line)
+ * \param[out] values - values of the row (device, obstacles, spaces)
+ * \return True if the row is correct
+ */
+bool BulkSizer::parseRow(const char *begin, const char *end, int values[RowValues])
+{
+    const char *field = begin;
+
+    for(int v = 0; v < RowValues; ++v)
+    {
+        const char *field_end = field;
+
+        while(field_end < end && *field_end != ',' && *field_end != ';')
+            ++field_end;
+        // Pominięcie białych znaków wokół wartości
+        const char *first = field;
+        const char *last = field_end;
+
+        while(first < last && (*first == ' ' || *first == '\t'))
+            ++first;
+        while(last > first && (last[-1] == ' ' || last[-1] == '\t'))
+            --last;
+
+        if(first == last)
+            values[v] = -1;
+        else
+        {
+            std::from_chars_result parsed = std::from_chars(first, last, values[v]);
+
+            if(parsed.ec != std::errc() || parsed.ptr != last || values[v] < -1 || values[v] >= MaxDimension)
+                return false;
+        }
+
+        if(v < DimNum && values[v] == -1)
+            return false;
+        // Ostatnia wartość kończy wiersz
+        if(v == RowValues - 1)
+            return field_end == end;
+        if(field_end == end)
+            return false;
+
+        field = field_end + 1;
+    }
+
+    return false;
+}
+/*!
+ * \brief Append the result of one row in the given format
+ *
+ * Dimensions and modules are 0, if the cover has not been generated.
+ *
+ * \param[in] chunk - sized block
+ * \param[in] row - index of the row in the block
+ * \param[in] format - format of the results
+ * \param[out] output - formatted results of the block
+ */
+void BulkSizer::formatRow(const BulkChunk & chunk, size_t row, BulkFormat format, std::string & output)
+{
+    char number[24];
+    auto appendNumber = [&](uint64_t value)
+    {
+        output.append(number, std::to_chars(number, number + sizeof(number), value).ptr);
+    };
+
+    if(format == BULK_JSONL)
+    {
+        output += "{\"line\":";
+        appendNumber(chunk.lines[row]);
+        output += ",\"status\":\"";
+        output += statusName(chunk.errors[row]);
+        output += "\",\"inner\":[";
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            appendNumber(chunk.dims[d][row]);
+            output += (d + 1 < DimNum) ? "," : "],\"outer\":[";
+        }
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            appendNumber(chunk.dims[DimNum + d][row]);
+            output += (d + 1 < DimNum) ? "," : "],\"modules\":";
+        }
+
+        appendNumber(chunk.modules[row]);
+        output += "}\n";
+        return;
+    }
+
+    appendNumber(chunk.lines[row]);
+
+    for(uint8_t d = 0; d < 2 * DimNum; ++d)
+    {
+        output += ',';
+        appendNumber(chunk.dims[d][row]);
+    }
+
+    output += ',';
+    appendNumber(chunk.modules[row]);
+    output += ',';
+    output += statusName(chunk.errors[row]);
+    output += '\n';
+}
+/*!
+ * \brief Parse, size and format one block
+ *
+ * Runs in the task of the pool. Buffers of the block grow only if the
+ * block has more rows than any previous one in this slot. Invalid rows
+ * are sized with the zero device (buffers stay aligned) and their
+ * results are replaced by the code of the invalid row afterwards.
+ *
+ * \param[in,out] chunk - block with the complete lines
+ * \param[in] format - format of the results
+ * \param[in] header_allowed - true for the first block of the file
+ */
+void BulkSizer::sizeChunk(BulkChunk & chunk, BulkFormat format, bool header_allowed) const
+{
+    chunk.rows = 0;
+    chunk.invalid = 0;
+    chunk.generated = 0;
+
+    const char *position = chunk.text.data();
+    const char *text_end = position + chunk.text.size();
+    uint64_t line = chunk.first_line;
+
+    for(; position < text_end; ++line)
+    {
+        const char *line_end = static_cast<const char *>(std::memchr(position, '\n', text_end - position));
+        line_end = (line_end == nullptr) ? text_end : line_end;
+
+        const char *row_end = (line_end > position && line_end[-1] == '\r') ? line_end - 1 : line_end;
+        const char *row_begin = position;
+        position = line_end + 1;
+        // Pusta linia
+        if(row_begin == row_end)
+            continue;
+
+        int values[RowValues];
+        bool valid = parseRow(row_begin, row_end, values);
+        // Nagłówek pliku (nienumeryczna pierwsza linia)
+        if(!valid && header_allowed && line == 1 && !(*row_begin >= '0' && *row_begin <= '9') && *row_begin != '-')
+            continue;
+
+        if(chunk.rows == chunk.lines.size())
+        {
+            size_t capacity = 2 * chunk.rows + 1024;
+
+            for(std::vector<int> & column : chunk.inputs)
+                column.resize(capacity);
+
+            chunk.lines.resize(capacity);
+            chunk.valid.resize(capacity);
+        }
+
+        for(int v = 0; v < RowValues; ++v)
+            chunk.inputs[v][chunk.rows] = valid ? values[v] : ((v < DimNum) ? 0 : -1);
+
+        chunk.lines[chunk.rows] = line;
+        chunk.valid[chunk.rows] = valid;
+        chunk.invalid += !valid;
+        ++chunk.rows;
+    }
+
+    if(chunk.dims[0].size() < chunk.rows)
+    {
+        for(std::vector<uint16_t> & column : chunk.dims)
+            column.resize(chunk.lines.size());
+
+        chunk.modules.resize(chunk.lines.size());
+        chunk.errors.resize(chunk.lines.size());
+    }
+
+    BatchInputs inputs;
+    BatchOutputs outputs;
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        inputs.device[d] = chunk.inputs[d].data();
+        inputs.obstacles[d] = chunk.inputs[DimNum + d].data();
+        outputs.inner_dim[d] = chunk.dims[d].data();
+        outputs.outer_dim[d] = chunk.dims[DimNum + d].data();
+    }
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        inputs.spaces[s] = chunk.inputs[2 * DimNum + s].data();
+
+    outputs.modules = chunk.modules.data();
+    outputs.errors = chunk.errors.data();
+
+    batch.sizeBatch(inputs, outputs, chunk.rows);
+
+    chunk.output.clear();
+
+    for(size_t row = 0; row < chunk.rows; ++row)
+    {
+        if(!chunk.valid[row])
+        {
+            for(std::vector<uint16_t> & column : chunk.dims)
+                column[row] = 0;
+
+            chunk.modules[row] = 0;
+            chunk.errors[row] = InvalidRow;
+        }
+
+        chunk.generated += (chunk.errors[row] == GenErrors::COVER_OK);
+        formatRow(chunk, row, format, chunk.output);
+    }
+}
+/*!
+ * \brief Size every row of the input stream and write the results in the input order
+ *
+ * Calling thread reads the blocks into the free slots of the ring and
+ * writes the finished ones in the order of reading, the pool sizes them
+ * in the meantime. If the next slot to read is still busy (written
+ * slowly or sized), the thread waits for the oldest block. Line, which
+ * does not end within the block, is carried to the next one. After the
+ * error of reading or writing, the blocks already sized are finished
+ * (the pool uses them), but nothing more is read or written.
+ *
+ * \param[in] input - stream with the rows of the site survey
+ * \param[in] output - stream for the results
+ * \param[in] format - format of the results
+ * \param[out] stats - statistics of the streamed file
+ * \return True if the whole input has been read and all results written
+ */
+bool BulkSizer::sizeStream(std::FILE *input, std::FILE *output, BulkFormat format, BulkStats & stats)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    stats = BulkStats();
+
+    bool correct = (format != BULK_CSV) || std::fputs(CsvHeader, output) >= 0;
+    bool end_of_input = !correct;
+    // Niedokończona linia poprzedniego bloku
+    std::string carry;
+    uint64_t line = 1;
+    size_t next_read = 0;
+    size_t next_write = 0;
+
+    while(true)
+    {
+        // Zapis gotowych bloków w kolejności wejścia
+        while(next_write < next_read)
+        {
+            BulkChunk & written = *chunks[next_write % chunks.size()];
+            {
+                std::lock_guard<std::mutex> guard(lock);
+
+                if(written.state != SLOT_DONE)
+                    break;
+            }
+
+            if(correct && std::fwrite(written.output.data(), 1, written.output.size(), output) != written.output.size())
+            {
+                correct = false;
+                end_of_input = true;
+            }
+
+            stats.rows += written.rows;
+            stats.invalid += written.invalid;
+            stats.generated += written.generated;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                written.state = SLOT_FREE;
+            }
+            ++next_write;
+        }
+
+        if(end_of_input && next_write == next_read)
+            break;
+
+        BulkChunk & read = *chunks[next_read % chunks.size()];
+        bool slot_free;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            slot_free = read.state == SLOT_FREE;
+        }
+        // Pełny pierścień (wolny zapis) - czekanie na najstarszy blok
+        if(end_of_input || !slot_free)
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            finished.wait(guard, [&]{ return chunks[next_write % chunks.size()]->state == SLOT_DONE; });
+            continue;
+        }
+
+        read.text.swap(carry);
+        carry.clear();
+
+        size_t carried = read.text.size();
+        read.text.resize(carried + chunk_bytes);
+        size_t got = std::fread(&read.text[carried], 1, chunk_bytes, input);
+        read.text.resize(carried + got);
+
+        if(got < chunk_bytes)
+        {
+            end_of_input = true;
+            correct = correct && !std::ferror(input);
+        }
+        else
+        {
+            size_t cut = read.text.rfind('\n');
+            // Linia dłuższa niż blok - doczytanie kolejnego
+            if(cut == std::string::npos)
+            {
+                carry.swap(read.text);
+                continue;
+            }
+
+            carry.assign(read.text, cut + 1, std::string::npos);
+            read.text.resize(cut + 1);
+        }
+
+        if(read.text.empty())
+            continue;
+
+        read.first_line = line;
+        line += std::count(read.text.begin(), read.text.end(), '\n');
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            read.state = SLOT_SIZING;
+        }
+
+        bool header_allowed = (next_read == 0);
+        BulkChunk *sized = &read;
+
+        pool.submit([this, sized, format, header_allowed]()
+        {
+            sizeChunk(*sized, format, header_allowed);
+            // Powiadomienie pod blokadą - po jej zwolnieniu BulkSizer może już nie istnieć
+            std::lock_guard<std::mutex> guard(lock);
+            sized->state = SLOT_DONE;
+            finished.notify_all();
+        });
+
+        ++next_read;
+    }
+
+    correct = correct && std::fflush(output) == 0;
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return correct;
+}
@@ -0,0 +1,333 @@
+#include "CatalogBlob.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HPSIZING_HAS_MMAP
+#endif
+
+/*!
+ * \brief Read the little-endian word
+ *
+ * Bytes are composed one by one, so the data does not have to be
+ * aligned and the result does not depend on the byte order of CPU.
+ *
+ * \param[in] data - beginning of the compiled catalog
+ * \param[in] word_idx - index of the word
+ * \return Value of the word
+ */
+uint32_t CatalogBlob::readWord(const unsigned char *data, size_t word_idx)
+{
+    const unsigned char *word = data + 4 * word_idx;
+
+    return static_cast<uint32_t>(word[0]) | (static_cast<uint32_t>(word[1]) << 8) |
+           (static_cast<uint32_t>(word[2]) << 16) | (static_cast<uint32_t>(word[3]) << 24);
+}
+/*!
+ * \brief Append the little-endian word
+ *
+ * \param[in,out] blob - compiled catalog
+ * \param[in] value - value of the word
+ */
+void CatalogBlob::appendWord(std::string & blob, uint32_t value)
+{
+    for(uint8_t i = 0; i < 4; ++i)
+        blob.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+/*!
+ * \brief Calculate CRC-32 of the data
+ *
+ * Standard polynomial (the same as in zip and PNG), so the checksum
+ * can be verified by the common tools.
+ *
+ * \param[in] data - checked bytes
+ * \param[in] size - number of bytes
+ * \return Value of the checksum
+ */
+uint32_t CatalogBlob::checksum(const unsigned char *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        crc ^= data[i];
+
+        for(uint8_t bit = 0; bit < 8; ++bit)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+/*!
+ * \brief Compile the loaded catalog into the binary form
+ *
+ * Write the header and then the sorted widths, depths, heights and
+ * heights of the wall modules, the inner and outer corrections, the
+ * default inner spaces, the distance to the wall and the choice of
+ * the stack. Checksum covers everything after the header.
+ *
+ * \param[in] catalog - loaded (complete) parts library
+ * \return Compiled catalog
+ */
+std::string CatalogBlob::compile(const CoverCatalog & catalog)
+{
+    std::string data;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        for(FixedDim dimension : catalog.returnBaseDimensions(static_cast<DIM_ID>(i)))
+            appendWord(data, static_cast<uint32_t>(dimension));
+    }
+
+    for(FixedDim module : catalog.returnModuleHeights())
+        appendWord(data, static_cast<uint32_t>(module));
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        appendWord(data, static_cast<uint32_t>(catalog.returnInnerCorrection(static_cast<DIM_ID>(i))));
+    for(uint8_t i = 0; i < DimNum; ++i)
+        appendWord(data, static_cast<uint32_t>(catalog.returnOuterCorrection(static_cast<DIM_ID>(i))));
+    for(uint8_t i = 0; i < DevSides; ++i)
+        appendWord(data, static_cast<uint32_t>(catalog.returnInnerOffset(i)));
+
+    appendWord(data, static_cast<uint32_t>(catalog.returnWallOffset()));
+    appendWord(data, static_cast<uint32_t>(catalog.returnStackGoal()));
+
+    std::string blob;
+
+    appendWord(blob, Magic);
+    appendWord(blob, Version);
+    appendWord(blob, static_cast<uint32_t>(4 * HeaderWords + data.size()));
+    appendWord(blob, checksum(reinterpret_cast<const unsigned char *>(data.data()), data.size()));
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        appendWord(blob, static_cast<uint32_t>(catalog.returnBaseDimensions(static_cast<DIM_ID>(i)).size()));
+
+    appendWord(blob, static_cast<uint32_t>(catalog.returnModuleHeights().size()));
+
+    return blob + data;
+}
+/*!
+ * \brief Load the catalog from the compiled form in the memory
+ *
+ * Check the magic number, version, number of the parts, size and
+ * checksum, then copy the values from the given memory into the new
+ * catalog (no text is parsed) and build its index. Dimensions must be
+ * already sorted.
+ *
+ * \param[in] data - beginning of the compiled catalog (any alignment)
+ * \param[in] size - number of bytes
+ * \return Shared pointer to the catalog or empty pointer if not valid
+ */
+CatalogPtr CatalogBlob::load(const void *data, size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+    if(bytes == nullptr || size < 4 * HeaderWords || readWord(bytes, 0) != Magic)
+    {
+        std::cerr << "\nCompiled catalog is not valid. Abort.\n";
+        return nullptr;
+    }
+
+    if(readWord(bytes, 1) != Version)
+    {
+        std::cerr << "\nUnsupported version of the compiled catalog: " << readWord(bytes, 1) << ". Abort.\n";
+        return nullptr;
+    }
+
+    // Liczby szerokości, głębokości, wysokości i modułów ścian
+    uint32_t counts[DimNum + 1];
+    size_t words = HeaderWords;
+
+    for(uint8_t i = 0; i <= DimNum; ++i)
+    {
+        counts[i] = readWord(bytes, 4 + i);
+
+        if(counts[i] > MaxParts)
+        {
+            std::cerr << "\nCompiled catalog has too many parts: " << counts[i] << ". Abort.\n";
+            return nullptr;
+        }
+
+        words += counts[i];
+    }
+
+    words += 2 * DimNum + DevSides + 2;
+
+    if(readWord(bytes, 2) != size || size != 4 * words ||
+       readWord(bytes, 3) != checksum(bytes + 4 * HeaderWords, size - 4 * HeaderWords))
+    {
+        std::cerr << "\nCompiled catalog is damaged (size or checksum). Abort.\n";
+        return nullptr;
+    }
+
+    std::shared_ptr<CoverCatalog> catalog = std::make_shared<CoverCatalog>();
+    size_t word_idx = HeaderWords;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        std::vector<FixedDim> & dimensions = catalog->base_dimensions[i];
+        dimensions.resize(counts[i]);
+
+        for(uint32_t j = 0; j < counts[i]; ++j)
+            dimensions[j] = static_cast<FixedDim>(readWord(bytes, word_idx++));
+
+        if(!std::is_sorted(dimensions.begin(), dimensions.end()))
+        {
+            std::cerr << "\nDimensions of the compiled catalog are not sorted. Abort.\n";
+            return nullptr;
+        }
+    }
+
+    catalog->module_heights.resize(counts[DimNum]);
+
+    for(uint32_t j = 0; j < counts[DimNum]; ++j)
+        catalog->module_heights[j] = static_cast<FixedDim>(readWord(bytes, word_idx++));
+
+    if(!std::is_sorted(catalog->module_heights.begin(), catalog->module_heights.end()))
+    {
+        std::cerr << "\nHeights of the wall modules in the compiled catalog are not sorted. Abort.\n";
+        return nullptr;
+    }
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        catalog->acc_in_dimensions[i] = static_cast<FixedDim>(readWord(bytes, word_idx++));
+    for(uint8_t i = 0; i < DimNum; ++i)
+        catalog->acc_out_dimensions[i] = static_cast<FixedDim>(readWord(bytes, word_idx++));
+    for(uint8_t i = 0; i < DevSides; ++i)
+        catalog->inner_offsets[i] = static_cast<FixedDim>(readWord(bytes, word_idx++));
+
+    catalog->wall_offset = static_cast<FixedDim>(readWord(bytes, word_idx++));
+
+    uint32_t goal = readWord(bytes, word_idx++);
+
+    if(goal > StackGoal::MIN_STACK_PARTS)
+    {
+        std::cerr << "\nUnknown choice of the stack in the compiled catalog: " << goal << ". Abort.\n";
+        return nullptr;
+    }
+
+    catalog->stack_goal = static_cast<StackGoal>(goal);
+
+    if(!catalog->isComplete())
+        return nullptr;
+
+    catalog->index.build(*catalog);
+
+    return catalog;
+}
+/*!
+ * \brief Load the catalog from the compiled file (mapped into the memory)
+ *
+ * On POSIX systems the file is mapped and the values are copied
+ * straight from the mapping, elsewhere (e.g. WASM) the file is read
+ * into the memory first.
+ *
+ * \param[in] path - path to the compiled catalog
+ * \return Shared pointer to the catalog or empty pointer if not loaded
+ */
+CatalogPtr CatalogBlob::loadFile(const std::string & path)
+{
+#ifdef HPSIZING_HAS_MMAP
+    int file = open(path.c_str(), O_RDONLY);
+    struct stat info;
+
+    if(file < 0 || fstat(file, &info) != 0 || info.st_size <= 0)
+    {
+        if(file >= 0)
+            close(file);
+
+        std::cerr << "\nUnable to open the compiled catalog: " << path << "\n";
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if(mapped == MAP_FAILED)
+    {
+        std::cerr << "\nUnable to map the compiled catalog: " << path << "\n";
+        return nullptr;
+    }
+
+    CatalogPtr catalog = load(mapped, size);
+    munmap(mapped, size);
+
+    return catalog;
+#else
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+    {
+        std::cerr << "\nUnable to open the compiled catalog: " << path << "\n";
+        return nullptr;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string contents = buffer.str();
+
+    return load(contents.data(), contents.size());
+#endif
+}
+/*!
+ * \brief Write the catalog as the C++ header with the constexpr tables
+ *
+ * Tables keep the same (sorted, fixed-point) values as the compiled
+ * file. Header is included by EmbeddedCatalog, which checks the
+ * tables at compile time.
+ *
+ * \param[in] catalog - loaded (complete) parts library
+ * \param[in] stream - output stream
+ */
+void CatalogBlob::writeHeader(const CoverCatalog & catalog, std::ostream & stream)
+{
+    auto write_table = [&stream](const char *name, const std::string & size, const std::vector<FixedDim> & values)
+    {
+        stream << "    static constexpr std::array<FixedDim, " << size << "> " << name << " = { ";
+
+        for(size_t i = 0; i < values.size(); ++i)
+            stream << (i ? ", " : "") << values[i];
+
+        stream << " };\n";
+    };
+
+    std::vector<FixedDim> inner_corrections;
+    std::vector<FixedDim> outer_corrections;
+    std::vector<FixedDim> inner_offsets;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        inner_corrections.push_back(catalog.returnInnerCorrection(static_cast<DIM_ID>(i)));
+        outer_corrections.push_back(catalog.returnOuterCorrection(static_cast<DIM_ID>(i)));
+    }
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        inner_offsets.push_back(catalog.returnInnerOffset(i));
+
+    stream << "// Generated by hpsizing_compile - do not edit.\n"
+           << "// Parts library in the fixed-point format (tenths of the millimetre).\n\n"
+           << "#ifndef COVERPARAMETERSTABLES_HPP\n#define COVERPARAMETERSTABLES_HPP\n\n"
+           << "#include <array>\n#include \"SizingTypes.hpp\"\n\nnamespace CatalogTables\n{\n";
+
+    write_table("Lengths", std::to_string(catalog.returnBaseDimensions(DIM_ID::LENGTH).size()),
+                catalog.returnBaseDimensions(DIM_ID::LENGTH));
+    write_table("Widths", std::to_string(catalog.returnBaseDimensions(DIM_ID::WIDTH).size()),
+                catalog.returnBaseDimensions(DIM_ID::WIDTH));
+    write_table("Heights", std::to_string(catalog.returnBaseDimensions(DIM_ID::HEIGHT).size()),
+                catalog.returnBaseDimensions(DIM_ID::HEIGHT));
+    write_table("ModuleHeights", std::to_string(catalog.returnModuleHeights().size()), catalog.returnModuleHeights());
+    write_table("InnerCorrections", "DimNum", inner_corrections);
+    write_table("OuterCorrections", "DimNum", outer_corrections);
+    write_table("InnerOffsets", "DevSides", inner_offsets);
+
+    stream << "    static constexpr FixedDim WallOffset = " << catalog.returnWallOffset() << ";\n"
+           << "    static constexpr StackGoal Goal = "
+           << ((catalog.returnStackGoal() == StackGoal::MIN_STACK_PARTS) ? "MIN_STACK_PARTS" : "MIN_STACK_HEIGHT") << ";\n"
+           << "}\n\n#endif // COVERPARAMETERSTABLES_HPP\n";
+}
@@ -0,0 +1,323 @@
+#include "CatalogIndex.hpp"
+#include "CoverCatalog.hpp"
+#include <algorithm>
+
+/*!
+ * \brief Initialization of the class CatalogIndex
+ *
+ * Index is empty until it is built. Maximum dimensions are set
+ * to -1, so every cover is too large for the empty index.
+ */
+CatalogIndex::CatalogIndex()
+{
+    for(uint8_t i = 0; i < DevSides; ++i)
+        default_spaces[i] = 0;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        max_dim[i] = -1;
+}
+/*!
+ * \brief Build the index from the sorted catalog
+ *
+ * Evaluate the precise dimensions of every part once, in the fixed-point
+ * format (tenths of the millimetre), with the same conversions to the
+ * millimetres as the original generator (truncation, floor of the
+ * thresholds). Stacks of the wall modules are found once for all
+ * heights up to the maximum height of the cover. If the catalog does
+ * not list the wall modules, the standard module is the only one and
+ * the stacks are the same as in the original algorithm (0, 1, 2...
+ * standard modules on each wall).
+ *
+ * \param[in] catalog - parts library with sorted dimensions
+ */
+void CatalogIndex::build(const CoverCatalog & catalog)
+{
+    default_spaces[0] = truncToMm(catalog.returnInnerOffset(1));
+    default_spaces[1] = truncToMm(catalog.returnInnerOffset(0));
+    default_spaces[2] = truncToMm(catalog.returnInnerOffset(2));
+    default_spaces[3] = truncToMm(catalog.returnInnerOffset(3));
+
+    for(uint8_t i = 0; i < DimNum - 1; ++i)
+    {
+        DIM_ID dim_idx = static_cast<DIM_ID>(i);
+        const std::vector<FixedDim> & available = catalog.returnBaseDimensions(dim_idx);
+        FixedDim correction = catalog.returnInnerCorrection(dim_idx);
+
+        max_dim[i] = truncToMm(available.back() + correction);
+        thresholds[i].clear();
+        inner_dim[i].clear();
+        outer_dim[i].clear();
+
+        for(FixedDim dimension : available)
+        {
+            FixedDim acc_available_dim = dimension + correction;
+            uint16_t inner = truncToMm(acc_available_dim);
+            uint16_t outer = truncToMm(toFixed(inner) + catalog.returnOuterCorrection(dim_idx));
+
+            thresholds[i].push_back(floorToMm(acc_available_dim));
+            inner_dim[i].push_back(inner);
+            outer_dim[i].push_back(outer);
+        }
+
+        buildFirstFit(thresholds[i], first_fit[i]);
+    }
+
+    const std::vector<FixedDim> & heights = catalog.returnBaseDimensions(DIM_ID::HEIGHT);
+    // Obcięcie do milimetrów po każdym kroku (jak w oryginale)
+    int max_height = truncToMm(heights[0] + heights[2]);
+    max_height = truncToMm(toFixed(max_height) + heights[1] * MaxWallModules);
+    max_dim[DIM_ID::HEIGHT] = max_height;
+    // Bez listy modułów ścian - tylko moduł standardowy
+    const std::vector<FixedDim> & modules = catalog.returnModuleHeights();
+    std::vector<int> steps;
+
+    if(modules.empty())
+        steps.push_back(truncToMm(heights[1]));
+
+    for(FixedDim module : modules)
+        steps.push_back(truncToMm(module));
+
+    module_types = steps.size();
+    standard_step = truncToMm(heights[1]);
+    stack_goal = catalog.returnStackGoal();
+    base_height = static_cast<uint16_t>(truncToMm(heights[0] + heights[2] + catalog.returnInnerCorrection(DIM_ID::HEIGHT)));
+
+    buildStacks(steps, max_height, catalog.returnOuterCorrection(DIM_ID::HEIGHT));
+
+    module_height = (height_sums.size() > 1) ? height_sums[1] - height_sums[0] : 0;
+    constant_step = module_height > 0;
+
+    for(size_t n = 1; n < height_sums.size(); ++n)
+        constant_step = constant_step && (height_sums[n] - height_sums[n - 1] == module_height);
+
+    buildFirstFit(height_sums, height_fit);
+    // Jeden typ modułu - najniższy stos ma też najmniej modułów
+    parts_fit.clear();
+
+    if(module_types > 1)
+        buildPartsFit();
+}
+/*!
+ * \brief Find all stacks of the wall modules up to the maximum height
+ *
+ * Module adds its height truncated to the millimetres (the inner height
+ * is truncated after each module, as in the original algorithm), so the
+ * heights of the stacks are the sums of the integer steps. Unbounded
+ * knapsack over these sums finds the smallest number of modules for
+ * every reachable height above the base, up to the first stack, which
+ * is not lower than the maximum height of the cover. The last module of
+ * each optimal stack is remembered, so the number of the modules of each
+ * type is recovered without the search. Stacks with more than
+ * MaxIndexModules modules on each wall are omitted.
+ *
+ * \param[in] steps - increase of the inner height for each type of the module
+ * \param[in] max_height - maximum inner height of the cover
+ * \param[in] out_correction - correction of the outer height
+ */
+void CatalogIndex::buildStacks(const std::vector<int> & steps, int max_height, FixedDim out_correction)
+{
+    int max_step = 0;
+
+    for(int step : steps)
+        max_step = (step > max_step) ? step : max_step;
+    // Pierwszy stos nie niższy niż maksymalna wysokość mieści się w zakresie
+    int span = ((max_height > base_height) ? max_height - base_height : 0) + max_step;
+    std::vector<int> parts(span + 1, MaxIndexModules + 1);
+    std::vector<int> last_type(span + 1, -1);
+
+    parts[0] = 0;
+
+    for(size_t m = 0; m < steps.size(); ++m)
+    {
+        for(int sum = (steps[m] > 0) ? steps[m] : span + 1; sum <= span; ++sum)
+        {
+            if(parts[sum - steps[m]] + 1 < parts[sum])
+            {
+                parts[sum] = parts[sum - steps[m]] + 1;
+                last_type[sum] = static_cast<int>(m);
+            }
+        }
+    }
+
+    height_sums.clear();
+    outer_heights.clear();
+    stack_modules.clear();
+    stack_counts.clear();
+
+    for(int sum = 0; sum <= span; ++sum)
+    {
+        if(parts[sum] > MaxIndexModules)
+            continue;
+
+        int inner = base_height + sum;
+        size_t first_count = stack_counts.size();
+
+        height_sums.push_back(inner);
+        outer_heights.push_back(static_cast<uint16_t>(truncToMm(toFixed(inner) + out_correction)));
+        stack_modules.push_back(parts[sum]);
+        stack_counts.resize(first_count + module_types, 0);
+
+        for(int rest = sum; rest > 0; rest -= steps[last_type[rest]])
+            ++stack_counts[first_count + last_type[rest]];
+
+        if(inner >= max_height)
+            break;
+    }
+}
+/*!
+ * \brief Build the table of the stacks with the fewest modules
+ *
+ * Table has one element for every required height from 0 up to the
+ * highest stack. Element is the index of the stack with the smallest
+ * number of modules among the stacks not lower than the required
+ * height (the lower one if equal). Table is filled from the highest
+ * height down, so every stack is visited once.
+ */
+void CatalogIndex::buildPartsFit()
+{
+    parts_fit.clear();
+
+    if(height_sums.empty() || height_sums.back() < 0)
+    {
+        parts_fit.push_back(-1);
+        return;
+    }
+
+    parts_fit.resize(height_sums.back() + 1);
+
+    int best = -1;
+    int stack_idx = static_cast<int>(height_sums.size()) - 1;
+
+    for(int required = height_sums.back(); required >= 0; --required)
+    {
+        for(; stack_idx >= 0 && height_sums[stack_idx] >= required; --stack_idx)
+        {
+            if(best == -1 || stack_modules[stack_idx] <= stack_modules[best])
+                best = stack_idx;
+        }
+
+        parts_fit[required] = best;
+    }
+}
+/*!
+ * \brief Build the first-fit table for the sorted thresholds
+ *
+ * Table has one element for every required dimension from 0 up to
+ * the largest threshold. Element is the index of the first threshold
+ * greater than or equal to the required dimension. If no threshold
+ * is positive, the table contains only -1 (nothing fits).
+ *
+ * \param[in] sorted - thresholds in the ascending order
+ * \param[out] table - first-fit table
+ */
+void CatalogIndex::buildFirstFit(const std::vector<int> & sorted, std::vector<int> & table)
+{
+    table.clear();
+
+    if(sorted.empty() || sorted.back() < 0)
+    {
+        table.push_back(-1);
+        return;
+    }
+
+    size_t j = 0;
+
+    for(int required = 0; required <= sorted.back(); ++required)
+    {
+        while(sorted[j] < required)
+            ++j;
+
+        table.push_back(static_cast<int>(j));
+    }
+}
+/*!
+ * \brief Replace the inner spaces not given by the user (-1) with the default ones
+ *
+ * Gives the same input data as the generator uses internally, so
+ * the inputs, which lead to the same cover, are equal afterwards.
+ *
+ * \param[in,out] input - input data from the user
+ */
+void CatalogIndex::resolveDefaults(SizingInput & input) const
+{
+    for(uint8_t i = 0; i < DevSides; ++i)
+        input.spaces[i] = (input.spaces[i] == -1) ? default_spaces[i] : input.spaces[i];
+}
+/*!
+ * \brief Find the smallest part that fits the required width or depth
+ *
+ * \param[in] dim_idx - required dimension (enumeration)
+ * \param[in] required - required inner dimension
+ * \return Index of the part or -1 if not found
+ */
+int CatalogIndex::findPart(DIM_ID dim_idx, int required) const
+{
+    const std::vector<int> & table = first_fit[dim_idx];
+
+    if(required < 0)
+        required = 0;
+
+    if(table.empty() || required >= static_cast<int>(table.size()))
+        return -1;
+
+    return table[required];
+}
+/*!
+ * \brief Find the size of the cover with the given inner height
+ *
+ * Size does not depend on the number of the modules (stack can mix
+ * the modules of different heights), but on the height of the stack
+ * on each wall measured in the standard modules and rounded to the
+ * nearest one (halves up). With the standard module only, it is the
+ * number of the modules on each wall.
+ *
+ * \param[in] inner_height - inner height of the generated cover
+ * \return Size of the cover (SIZE_XL for the higher stacks too)
+ */
+COVER_SIZE CatalogIndex::findCoverSize(int inner_height) const
+{
+    int stack = inner_height - base_height;
+
+    if(standard_step <= 0 || stack <= 0)
+        return SIZE_S;
+
+    int standard_modules = (2 * stack + standard_step) / (2 * standard_step);
+
+    return static_cast<COVER_SIZE>(std::min<int>(standard_modules, SIZE_XL));
+}
+/*!
+ * \brief Find the stack of the wall modules for the required height
+ *
+ * The lowest stack is found by the closed form (ceiling of the missing
+ * height divided by the difference of the stacks), if the stacks
+ * differ evenly, otherwise the heights of the stacks are searched.
+ * Stack with the fewest modules is read from the precalculated table
+ * (with one type of the module it is always the lowest stack).
+ *
+ * \param[in] required - required inner height
+ * \param[in] goal - criterion of the choice of the stack
+ * \return Index of the stack or -1 if height is not available
+ */
+int CatalogIndex::findStack(int required, StackGoal goal) const
+{
+    if(height_sums.empty())
+        return -1;
+
+    if(goal == StackGoal::MIN_STACK_PARTS && module_types > 1)
+    {
+        required = (required > 0) ? required : 0;
+        return (required < static_cast<int>(parts_fit.size())) ? parts_fit[required] : -1;
+    }
+
+    if(required <= base_height)
+        return 0;
+
+    int stack_idx = 0;
+
+    if(constant_step)
+        stack_idx = (required - base_height + module_height - 1) / module_height;
+    else
+        stack_idx = std::lower_bound(height_sums.begin(), height_sums.end(), required) - height_sums.begin();
+
+    return (stack_idx < static_cast<int>(height_sums.size())) ? stack_idx : -1;
+}
@@ -0,0 +1,187 @@
+#include "CatalogWatcher.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "CatalogBlob.hpp"
+
+/*!
+ * \brief Initialization of the class CatalogWatcher
+ *
+ * Nothing is loaded until the first check of the file.
+ *
+ * \param[in] file_path - path to the watched file (.hpcb - compiled catalog, text otherwise)
+ * \param[in] check_interval - time between the checks of the file
+ */
+CatalogWatcher::CatalogWatcher(const std::string & file_path, std::chrono::milliseconds check_interval)
+    : path(file_path), interval(check_interval)
+{
+
+}
+/*!
+ * \brief Stop the thread before destruction
+ */
+CatalogWatcher::~CatalogWatcher()
+{
+    stop();
+}
+/*!
+ * \brief Start checking the file in the background
+ *
+ * The first check is done at once, so the file present at the
+ * start is loaded without waiting for the interval.
+ */
+void CatalogWatcher::start()
+{
+    if(worker.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(stop_lock);
+        stopping = false;
+    }
+
+    worker = std::thread(&CatalogWatcher::run, this);
+}
+/*!
+ * \brief Stop checking the file
+ *
+ * Waits for the current check (if any) to finish.
+ */
+void CatalogWatcher::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(stop_lock);
+        stopping = true;
+    }
+
+    wake_up.notify_all();
+
+    if(worker.joinable())
+        worker.join();
+}
+/*!
+ * \brief Check the file periodically until stopped
+ */
+void CatalogWatcher::run()
+{
+    std::unique_lock<std::mutex> guard(stop_lock);
+
+    while(!stopping)
+    {
+        guard.unlock();
+        reload();
+        guard.lock();
+
+        wake_up.wait_for(guard, interval, [this] { return stopping; });
+    }
+}
+/*!
+ * \brief Check the file now and publish the catalog if changed
+ *
+ * File is loaded only if its modification time or size has changed
+ * since the last check. If the file has been changed again during
+ * the loading (still written), it is loaded at the next check. Not
+ * valid file is counted as rejected and not checked again until the
+ * next change.
+ *
+ * \return True if the new catalog has been published and false otherwise
+ */
+bool CatalogWatcher::reload()
+{
+    std::lock_guard<std::mutex> guard(reload_lock);
+
+    auto stamp = [this](std::chrono::nanoseconds::rep & time, int64_t & size)
+    {
+        std::error_code error;
+        auto modified = std::filesystem::last_write_time(path, error);
+
+        if(error)
+            return false;
+
+        size = static_cast<int64_t>(std::filesystem::file_size(path, error));
+        time = std::chrono::duration_cast<std::chrono::nanoseconds>(modified.time_since_epoch()).count();
+
+        return !error;
+    };
+
+    std::chrono::nanoseconds::rep time = 0;
+    int64_t size = 0;
+
+    if(!stamp(time, size) || (time == last_time && size == last_size))
+        return false;
+
+    CatalogPtr parts = loadFile();
+
+    std::chrono::nanoseconds::rep time_after = 0;
+    int64_t size_after = 0;
+    // Plik zmieniony w trakcie wczytywania - ponownie przy następnym sprawdzeniu
+    if(!stamp(time_after, size_after) || time_after != time || size_after != size)
+        return false;
+
+    last_time = time;
+    last_size = size;
+
+    if(!parts)
+    {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        std::cerr << "\nChanged catalog " << path << " is not valid, previous one is still used.\n";
+        return false;
+    }
+
+    publish(parts);
+
+    return true;
+}
+/*!
+ * \brief Load the catalog from the file (text or compiled)
+ *
+ * Both loaders validate the catalog (syntax or checksum and the
+ * completeness), so only the catalog usable by the generator is
+ * returned.
+ *
+ * \return Shared pointer to the catalog or empty pointer if not valid
+ */
+CatalogPtr CatalogWatcher::loadFile() const
+{
+    if(std::filesystem::path(path).extension() == ".hpcb")
+        return CatalogBlob::loadFile(path);
+
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return nullptr;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string contents = buffer.str();
+
+    return CoverCatalog::loadShared(contents);
+}
+/*!
+ * \brief Publish the given catalog
+ *
+ * Pointer is replaced first and the version is increased after it,
+ * so the user, who sees the new version, always gets the new catalog.
+ *
+ * \param[in] parts - valid parts library (ignored if empty)
+ */
+void CatalogWatcher::publish(CatalogPtr parts)
+{
+    if(!parts)
+        return;
+
+    std::atomic_store_explicit(&catalog, parts, std::memory_order_release);
+    version.fetch_add(1, std::memory_order_release);
+}
+/*!
+ * \brief Return the last published catalog
+ *
+ * Called only after the change of the version, not for every sizing.
+ *
+ * \return Shared pointer to the catalog or empty pointer if nothing published
+ */
+CatalogPtr CatalogWatcher::returnCatalog() const
+{
+    return std::atomic_load_explicit(&catalog, std::memory_order_acquire);
+}
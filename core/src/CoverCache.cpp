@@ -0,0 +1,221 @@
+#include "CoverCache.hpp"
+
+/*!
+ * \brief Hash of the normalized input data (FNV-1a of all values)
+ *
+ * \param[in] input - normalized input data
+ * \return Value of the hash
+ */
+size_t SizingInputHash::operator()(const SizingInput & input) const
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    auto mix = [&hash](int value)
+    {
+        hash ^= static_cast<uint32_t>(value);
+        hash *= 1099511628211ULL;
+    };
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        mix(input.device[i]);
+        mix(input.obstacles[i]);
+    }
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        mix(input.spaces[i]);
+
+    return static_cast<size_t>(hash);
+}
+/*!
+ * \brief Comparison of the normalized input data
+ *
+ * \param[in] first - first input data
+ * \param[in] second - second input data
+ * \return True if all values are equal
+ */
+bool SizingInputEqual::operator()(const SizingInput & first, const SizingInput & second) const
+{
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        if(first.device[i] != second.device[i] || first.obstacles[i] != second.obstacles[i])
+            return false;
+    }
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+    {
+        if(first.spaces[i] != second.spaces[i])
+            return false;
+    }
+
+    return true;
+}
+/*!
+ * \brief Initialization of the class CoverCache
+ *
+ * Memory for all entries is reserved at once, so the cache does
+ * not grow later. Capacity 0 disables the cache.
+ *
+ * \param[in] entries_num - maximum number of entries
+ */
+CoverCache::CoverCache(size_t entries_num) : current(std::make_shared<CatalogSnapshot>()), capacity(entries_num)
+{
+    entries.reserve(capacity);
+    slots.reserve(capacity);
+}
+/*!
+ * \brief Initialization of the class CoverCache with the given parts library
+ *
+ * \param[in] parts - parts library loaded by the caller
+ * \param[in] entries_num - maximum number of entries
+ */
+CoverCache::CoverCache(CatalogPtr parts, size_t entries_num) : CoverCache(entries_num)
+{
+    setCatalog(parts);
+}
+/*!
+ * \brief Replace the parts library and drop all entries
+ *
+ * Results of the old catalog are not valid anymore. New generator
+ * is published with the next version, so the requests still sizing
+ * with the old one do not store their results.
+ *
+ * \param[in] parts - parts library loaded by the caller (ignored if empty)
+ */
+void CoverCache::setCatalog(CatalogPtr parts)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::shared_ptr<const CatalogSnapshot> previous = std::atomic_load(&current);
+    std::shared_ptr<CatalogSnapshot> next = std::make_shared<CatalogSnapshot>(*previous);
+
+    next->sizer.setCatalog(parts);
+    ++next->version;
+    std::atomic_store(&current, std::shared_ptr<const CatalogSnapshot>(next));
+    entries.clear();
+    slots.clear();
+    clock_hand = 0;
+}
+/*!
+ * \brief Generate the cover or take the remembered result
+ *
+ * Take the snapshot of the generator, normalize the input data and
+ * look for it in the cache. If found (sized with the same catalog),
+ * mark the entry as recently used and copy its result. Otherwise,
+ * size the cover with the snapshot (outside the lock) and remember
+ * the result.
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if generated, false if not
+ */
+bool CoverCache::generateCover(const SizingInput & dimensions, SizingResult & result)
+{
+    std::shared_ptr<const CatalogSnapshot> snapshot = std::atomic_load(&current);
+    SizingInput key = dimensions;
+    snapshot->sizer.returnCatalog().returnIndex().resolveDefaults(key);
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto found = slots.find(key);
+
+        if(found != slots.end() && entries[found->second].version == snapshot->version)
+        {
+            CacheEntry & entry = entries[found->second];
+            entry.referenced = true;
+            result = entry.result;
+            ++hits;
+
+            return result.error == GenErrors::COVER_OK;
+        }
+
+        ++misses;
+    }
+
+    bool generated = snapshot->sizer.generateCover(key, result);
+    store(key, result, snapshot->version);
+
+    return generated;
+}
+/*!
+ * \brief Remember the result of the generator
+ *
+ * Free entry is used while available. Then the clock hand goes
+ * around the entries, clears the recently used marks and replaces
+ * the first entry, which has not been used since the last pass.
+ * Result of the replaced catalog is dropped.
+ *
+ * \param[in] key - normalized input data
+ * \param[in] result - result of the generator
+ * \param[in] version - version of the catalog, which sized the result
+ */
+void CoverCache::store(const SizingInput & key, const SizingResult & result, uint64_t version)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    // Inny wątek mógł w międzyczasie zapamiętać ten sam wynik lub zmienić katalog
+    if(capacity == 0 || slots.count(key) || version != std::atomic_load(&current)->version)
+        return;
+
+    size_t slot = entries.size();
+
+    if(entries.size() < capacity)
+        entries.emplace_back();
+    else
+    {
+        while(entries[clock_hand].referenced)
+        {
+            entries[clock_hand].referenced = false;
+            clock_hand = (clock_hand + 1) % capacity;
+        }
+
+        slot = clock_hand;
+        slots.erase(entries[slot].key);
+        clock_hand = (clock_hand + 1) % capacity;
+    }
+
+    entries[slot].key = key;
+    entries[slot].result = result;
+    entries[slot].version = version;
+    entries[slot].referenced = false;
+    slots[key] = slot;
+}
+/*!
+ * \brief Drop all entries (counters are kept)
+ */
+void CoverCache::clear()
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    entries.clear();
+    slots.clear();
+    clock_hand = 0;
+}
+/*!
+ * \brief Return number of results found in the cache
+ *
+ * \return Number of hits
+ */
+uint64_t CoverCache::returnHits() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return hits;
+}
+/*!
+ * \brief Return number of results sized by the generator
+ *
+ * \return Number of misses
+ */
+uint64_t CoverCache::returnMisses() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return misses;
+}
+/*!
+ * \brief Return number of the occupied entries
+ *
+ * \return Number of entries
+ */
+size_t CoverCache::returnSize() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return entries.size();
+}
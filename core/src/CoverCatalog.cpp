@@ -0,0 +1,407 @@
+#include "CoverCatalog.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+
+const VariableNames CoverCatalog::params;
+
+/*!
+ * \brief Initialization of the class CoverCatalog
+ *
+ * Fill the stored static arrays with zeros using for loops.
+ */
+CoverCatalog::CoverCatalog()
+{
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        acc_in_dimensions[i] = 0;
+        acc_out_dimensions[i] = 0;
+    }
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        inner_offsets[i] = 0;
+}
+/*!
+ * \brief Read parameters of the generator from the contents of the configuration file
+ *
+ * \param[in] contents - whole text of the configuration file
+ * \return True if correctly loaded and false otherwise
+ */
+bool CoverCatalog::readParameters(const std::string & contents)
+{
+    return readParameters(contents.data(), contents.size());
+}
+/*!
+ * \brief Read parameters of the generator from the raw bytes of the configuration file
+ *
+ * Split the given bytes line by line in one pass (both '\n' and "\r\n"
+ * endings are accepted), without copying them. Every line is passed
+ * to the parser, which interprets it and distributes the values to
+ * the correct buffers. The first error stops the parsing. If the
+ * catalog is complete, sort the dimensions and build the index used
+ * by the generator.
+ *
+ * \param[in] data - beginning of the configuration file (UTF-8 or ASCII)
+ * \param[in] size - number of bytes
+ * \return True if correctly loaded and false otherwise
+ */
+bool CoverCatalog::readParameters(const char *data, size_t size)
+{
+    const char *end = data + size;
+    const char *line = data;
+    size_t line_num = 1;
+    uint16_t read_params = 0;
+
+    while(line < end)
+    {
+        const char *line_end = static_cast<const char *>(std::memchr(line, '\n', end - line));
+        line_end = (line_end != nullptr) ? line_end : end;
+
+        if(!readLine(line, line_end, line_num, read_params))
+            return false;
+
+        line = line_end + 1;
+        ++line_num;
+    }
+
+    if(!isComplete())
+        return false;
+
+    sortDimensions();
+    index.build(*this);
+
+    return true;
+}
+/*!
+ * \brief Load the catalog, which can be shared by many generators
+ *
+ * Parse the contents of the configuration file into the new
+ * catalog. After loading, the catalog is available only as the
+ * constant object, so it can be read by many threads without
+ * any synchronization.
+ *
+ * \param[in] contents - whole text of the configuration file
+ * \return Shared pointer to the catalog or empty pointer if not loaded
+ */
+std::shared_ptr<const CoverCatalog> CoverCatalog::loadShared(const std::string & contents)
+{
+    return loadShared(contents.data(), contents.size());
+}
+/*!
+ * \brief Load the catalog from the raw bytes of the configuration file
+ *
+ * \param[in] data - beginning of the configuration file
+ * \param[in] size - number of bytes
+ * \return Shared pointer to the catalog or empty pointer if not loaded
+ */
+std::shared_ptr<const CoverCatalog> CoverCatalog::loadShared(const char *data, size_t size)
+{
+    std::shared_ptr<CoverCatalog> catalog = std::make_shared<CoverCatalog>();
+
+    if(!catalog->readParameters(data, size))
+        return nullptr;
+
+    return catalog;
+}
+/*!
+ * \brief Check if the catalog contains everything needed by the generator
+ *
+ * Generator needs at least one available width and depth of the
+ * cover and exactly three heights of the modules (base, standard
+ * and top). Wall modules, if listed, must be at least 1 mm high.
+ *
+ * \return True if the catalog can be used and false otherwise
+ */
+bool CoverCatalog::isComplete() const
+{
+    if(base_dimensions[DIM_ID::LENGTH].empty() || base_dimensions[DIM_ID::WIDTH].empty())
+    {
+        std::cerr << "\nCover parameters do not contain lengths or widths. Abort.\n";
+        return false;
+    }
+
+    if(base_dimensions[DIM_ID::HEIGHT].size() != DimNum)
+    {
+        std::cerr << "\nCover parameters must contain three heights of the modules. Abort.\n";
+        return false;
+    }
+
+    for(FixedDim module : module_heights)
+    {
+        if(module < FixedScale)
+        {
+            std::cerr << "\nHeights of the wall modules must be at least 1 mm. Abort.\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+/*!
+ * \brief Sort the base dimensions in the ascending order
+ *
+ * Sort all dimensions of the base parts of the cover in order
+ * to make sure that they can be correctly found later by the
+ * generator (the same ordering is applied as in the GUI version).
+ */
+void CoverCatalog::sortDimensions()
+{
+    for(uint8_t i = 0; i < DimNum; ++i)
+        std::sort(base_dimensions[i].begin(), base_dimensions[i].end());
+
+    std::sort(module_heights.begin(), module_heights.end());
+}
+/*!
+ * \brief Display the loaded configuration parameters (debug only)
+ *
+ * Print all the parameters loaded from the configuration file
+ * on the standard output, usually terminal. It is used to check
+ * if the configuration file has been correctly parsed.
+ */
+void CoverCatalog::printParameters() const
+{
+    auto mm = [](FixedDim value) { return value / static_cast<double>(FixedScale); };
+
+    std::cout << "\nBase dimensions: \n";
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        std::cout << "\t";
+        for(uint8_t j = 0; j < base_dimensions[i].size(); ++j)
+            std::cout << mm(base_dimensions[i][j]) << " ";
+
+        std::cout << "\n";
+    }
+
+    std::cout << "\nOuter dimensions add-ons: \n\t";
+    for(uint8_t i = 0; i < DimNum; ++i)
+        std::cout << mm(acc_out_dimensions[i]) << " ";
+
+    std::cout << "\n\nInner dimensions add-ons: \n\t";
+    for(uint8_t i = 0; i < DimNum; ++i)
+        std::cout << mm(acc_in_dimensions[i]) << " ";
+
+    std::cout << "\n\nMinimal spaces: \n\t";
+    for(uint8_t i = 0; i < DevSides; ++i)
+        std::cout << mm(inner_offsets[i]) << " ";
+
+    std::cout << "\n\nWall offset: \n\t" << mm(wall_offset) << "\n";
+
+    std::cout << "\nWall modules: \n\t";
+    for(FixedDim module : module_heights)
+        std::cout << mm(module) << " ";
+
+    std::cout << "\n\nStack goal: \n\t" << stack_goal << "\n";
+}
+/*!
+ * \brief Read and analyze the line of the file
+ *
+ * Empty lines and lines starting with the '#' sign (comments) are
+ * omitted. Other lines must contain the name of the parameter, the
+ * colon and the values separated by spaces - one value for the single
+ * parameters and at least one for the dimensions of the parts and the
+ * heights of the wall modules. Choice of the stack must be 0 or 1. Unknown
+ * parameter, parameter given twice, missing colon, invalid number and
+ * surplus value are reported with the line and column. Line is read
+ * in place, nothing is copied.
+ *
+ * \param[in] begin - beginning of the line
+ * \param[in] end - end of the line (without the new line sign)
+ * \param[in] line_num - number of the line (from 1)
+ * \param[in,out] read_params - parameters already read (bit mask)
+ * \return True if succeed and false otherwise
+ */
+bool CoverCatalog::readLine(const char *begin, const char *end, size_t line_num, uint16_t & read_params)
+{
+    const char *pos = skipSpaces(begin, end);
+    // Pominięcie pustych linii i komentarzy
+    if(pos == end || *pos == '#')
+        return true;
+
+    const char *name_end = pos;
+
+    while(name_end < end && (std::isalnum(static_cast<unsigned char>(*name_end)) || *name_end == '_'))
+        ++name_end;
+
+    std::string_view var_name(pos, name_end - pos);
+    int8_t param_idx = findParameter(var_name);
+
+    if(param_idx < 0)
+    {
+        reportError(line_num, pos - begin, "Unknown parameter", var_name);
+        return false;
+    }
+
+    if(read_params & (1 << param_idx))
+    {
+        reportError(line_num, pos - begin, "Parameter given twice", var_name);
+        return false;
+    }
+
+    pos = skipSpaces(name_end, end);
+
+    if(pos == end || *pos != ':')
+    {
+        reportError(line_num, pos - begin, "Lack of ':' symbol after", var_name);
+        return false;
+    }
+    // Wymiary części (lista) albo pojedyncza wartość
+    FixedDim goal_value = 0;
+    FixedDim *single_values[ParamsNum] = { nullptr, nullptr, nullptr,
+                                           &acc_out_dimensions[0], &acc_out_dimensions[1], &acc_out_dimensions[2],
+                                           &acc_in_dimensions[0], &acc_in_dimensions[1], &acc_in_dimensions[2],
+                                           &inner_offsets[0], &inner_offsets[1], &inner_offsets[2], &inner_offsets[3],
+                                           &wall_offset, nullptr, &goal_value };
+    std::vector<FixedDim> *list = (param_idx < DimNum) ? &base_dimensions[param_idx] :
+                                  (param_idx == ModulesParam) ? &module_heights : nullptr;
+    size_t values_num = 0;
+
+    for(pos = skipSpaces(pos + 1, end); pos < end; pos = skipSpaces(pos, end))
+    {
+        FixedDim value = 0;
+        const char *value_end = parseFixed(pos, end, value);
+
+        if(value_end == nullptr || (value_end < end && !isSpace(*value_end)) ||
+           (param_idx == GoalParam && value != toFixed(StackGoal::MIN_STACK_HEIGHT) && value != toFixed(StackGoal::MIN_STACK_PARTS)))
+        {
+            reportError(line_num, pos - begin, "Wrong value of", var_name);
+            return false;
+        }
+
+        if(list != nullptr)
+            list->push_back(value);
+        else if(values_num == 0)
+            *single_values[param_idx] = value;
+        else
+        {
+            reportError(line_num, pos - begin, "Too many values of", var_name);
+            return false;
+        }
+
+        ++values_num;
+        pos = value_end;
+    }
+
+    if(values_num == 0)
+    {
+        reportError(line_num, end - begin, "No value of", var_name);
+        return false;
+    }
+
+    if(param_idx == GoalParam)
+        stack_goal = static_cast<StackGoal>(truncToMm(goal_value));
+
+    read_params |= 1 << param_idx;
+
+    return true;
+}
+/*!
+ * \brief Find the index of the parameter with the given name
+ *
+ * Order of the parameters: widths, depths, heights of the parts,
+ * outer corrections, inner corrections, front, side, back and top
+ * space, the distance to the wall, the heights of the wall modules
+ * and the choice of the stack.
+ *
+ * \param[in] name - name of the parameter
+ * \return Index of the parameter or -1 if unknown
+ */
+int8_t CoverCatalog::findParameter(std::string_view name)
+{
+    const std::string *names[ParamsNum] = { &params.BASE_LENGTH, &params.BASE_WIDTH, &params.BASE_HEIGHT,
+                                            &params.OUT_LENGTH, &params.OUT_WIDTH, &params.OUT_HEIGHT,
+                                            &params.ACC_LENGTH, &params.ACC_WIDTH, &params.ACC_HEIGHT,
+                                            &params.FRONT_SPACE, &params.SIDE_SPACE, &params.BACK_SPACE,
+                                            &params.TOP_SPACE, &params.WALL_SPACE, &params.MODULE_HEIGHTS,
+                                            &params.STACK_GOAL };
+
+    for(uint8_t i = 0; i < ParamsNum; ++i)
+    {
+        if(name == *names[i])
+            return i;
+    }
+
+    return -1;
+}
+/*!
+ * \brief Convert the decimal number to the fixed-point format
+ *
+ * Number (optional sign, integer part and optional decimal places)
+ * is converted exactly to the tenths of the millimetre and rounded
+ * half away from zero on the second decimal place. Integer part is
+ * read with std::from_chars, so the result does not depend on the
+ * locale and nothing is allocated.
+ *
+ * \param[in] begin - beginning of the number
+ * \param[in] end - end of the line
+ * \param[out] value - value in tenths of the millimetre
+ * \return Position after the number or nullptr if not a valid number
+ */
+const char *CoverCatalog::parseFixed(const char *begin, const char *end, FixedDim & value)
+{
+    const char *pos = begin;
+    bool negative = (pos < end && *pos == '-');
+
+    if(pos < end && (*pos == '-' || *pos == '+'))
+        ++pos;
+
+    uint64_t whole = 0;
+    std::from_chars_result integer = std::from_chars(pos, end, whole);
+
+    if(integer.ec == std::errc::result_out_of_range || whole > static_cast<uint64_t>(INT32_MAX / FixedScale))
+        return nullptr;
+
+    bool has_digits = (integer.ptr != pos);
+    uint64_t scaled = whole * FixedScale;
+
+    pos = integer.ptr;
+
+    if(pos < end && *pos == '.')
+    {
+        // Dziesiąte części bez zmian, setne decydują o zaokrągleniu
+        for(size_t place = 0; ++pos < end && *pos >= '0' && *pos <= '9'; ++place)
+        {
+            has_digits = true;
+
+            if(place == 0)
+                scaled += *pos - '0';
+            else if(place == 1)
+                scaled += (*pos >= '5');
+        }
+    }
+
+    if(!has_digits || scaled > INT32_MAX)
+        return nullptr;
+
+    value = negative ? -static_cast<FixedDim>(scaled) : static_cast<FixedDim>(scaled);
+
+    return pos;
+}
+/*!
+ * \brief Skip the spaces and tabs
+ *
+ * \param[in] begin - current position
+ * \param[in] end - end of the line
+ * \return Position of the first other sign or the end of the line
+ */
+const char *CoverCatalog::skipSpaces(const char *begin, const char *end)
+{
+    while(begin < end && isSpace(*begin))
+        ++begin;
+
+    return begin;
+}
+/*!
+ * \brief Report the error of the configuration file with its position
+ *
+ * \param[in] line_num - number of the line (from 1)
+ * \param[in] offset - position of the error in the line (from 0)
+ * \param[in] message - description of the error
+ * \param[in] var_name - name of the parameter
+ */
+void CoverCatalog::reportError(size_t line_num, size_t offset, const char *message, std::string_view var_name)
+{
+    std::cerr << "\nError during reading the file (line " << line_num << ", column " << offset + 1 << "). "
+              << message << " '" << var_name << "'. Abort.\n";
+}
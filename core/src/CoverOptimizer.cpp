@@ -0,0 +1,180 @@
+#include "CoverOptimizer.hpp"
+#include <algorithm>
+
+/*!
+ * \brief Initialization of the class CoverOptimizer
+ *
+ * \param[in] parts - parts library loaded by the caller
+ * \param[in] workers - pool, which runs the search (shared with other users)
+ */
+CoverOptimizer::CoverOptimizer(CatalogPtr parts, WorkStealingPool & workers) : sizer(parts), pool(workers)
+{
+
+}
+/*!
+ * \brief Compare two candidates (better first)
+ *
+ * Lower score is better. Equal scores are ordered by the number
+ * of modules and the indices of the parts, so the order of the
+ * results does not depend on the order of the tasks.
+ *
+ * \param[in] first - first candidate
+ * \param[in] second - second candidate
+ * \return True if the first candidate is better
+ */
+bool CoverOptimizer::isBetter(const CoverCandidate & first, const CoverCandidate & second)
+{
+    if(first.score != second.score)
+        return first.score < second.score;
+    if(first.modules != second.modules)
+        return first.modules < second.modules;
+    if(first.length_idx != second.length_idx)
+        return first.length_idx < second.length_idx;
+
+    return first.width_idx < second.width_idx;
+}
+/*!
+ * \brief Find the best covers for the input data
+ *
+ * Resolve the default spaces and the required inner dimensions in
+ * the same way as CoverSizer. If the cover exceeds the limits or no
+ * part fits, there are no candidates. Otherwise, every width part,
+ * which fits, is searched by the separate task of the pool. At the
+ * end the K best candidates of all tasks are merged.
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[in] goal - criterion of the ranking
+ * \param[in] top_k - maximum number of the returned candidates
+ * \param[out] candidates - best candidates (better first)
+ * \return Number of the returned candidates
+ */
+size_t CoverOptimizer::optimize(const SizingInput & dimensions, OptimizerGoal goal, size_t top_k,
+                                std::vector<CoverCandidate> & candidates) const
+{
+    candidates.clear();
+
+    SizingResult request;
+    sizer.generateCover(dimensions, request);
+    // Kolizja obudowy pierwszego wyboru nie wyklucza innych kombinacji
+    bool searchable = request.error == GenErrors::COVER_OK || request.error == GenErrors::LEFT_COLLISION ||
+                      request.error == GenErrors::RIGHT_COLLISION || request.error == GenErrors::BACK_COLLISION;
+
+    if(!searchable || top_k == 0)
+        return 0;
+
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+    int first_length = index.findPart(DIM_ID::LENGTH, request.approx_inner_dim[DIM_ID::LENGTH]);
+    size_t tasks_num = index.returnInnerDims(DIM_ID::LENGTH).size() - first_length;
+
+    std::vector<std::vector<CoverCandidate>> partial(tasks_num);
+
+    pool.parallelFor(tasks_num, [&](size_t task)
+    {
+        searchLength(request, goal, top_k, first_length + static_cast<int>(task), partial[task]);
+    });
+
+    for(const std::vector<CoverCandidate> & best : partial)
+        candidates.insert(candidates.end(), best.begin(), best.end());
+
+    std::sort(candidates.begin(), candidates.end(), isBetter);
+
+    if(candidates.size() > top_k)
+        candidates.resize(top_k);
+
+    return candidates.size();
+}
+/*!
+ * \brief Search all combinations with the given width part
+ *
+ * Collisions on the left and right side depend only on the width
+ * of the cover, so they are checked once. Depths and stacks of the
+ * modules are visited in the ascending order, thus the score never
+ * decreases in the inner loops. If the score of the candidate is too
+ * high to enter the K best ones, the rest of the loop is skipped (the
+ * higher stack with the same score can still have fewer modules).
+ *
+ * \param[in] request - resolved input data and required inner dimensions
+ * \param[in] goal - criterion of the ranking
+ * \param[in] top_k - maximum number of the kept candidates
+ * \param[in] length_idx - index of the width part
+ * \param[out] best - K best candidates of the task (unordered)
+ */
+void CoverOptimizer::searchLength(const SizingResult & request, OptimizerGoal goal, size_t top_k,
+                                  int length_idx, std::vector<CoverCandidate> & best) const
+{
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+    const std::vector<int> & inner_widths = index.returnInnerDims(DIM_ID::WIDTH);
+    const std::vector<int> & outer_widths = index.returnOuterDims(DIM_ID::WIDTH);
+    const std::vector<int> & inner_heights = index.returnInnerHeights();
+    const std::vector<int> & outer_heights = index.returnOuterHeights();
+    const std::vector<int> & stack_modules = index.returnStackModules();
+
+    const SizingInput & input = request.input;
+    int inner_length = index.returnInnerDims(DIM_ID::LENGTH)[length_idx];
+    int outer_length = index.returnOuterDims(DIM_ID::LENGTH)[length_idx];
+    // Kolizje z przeszkodami po lewej i prawej stronie
+    int dist_to_side = input.device[0] / 2;
+
+    if(input.obstacles[0] != -1 && dist_to_side + input.obstacles[0] <= outer_length / 2)
+        return;
+    if(input.obstacles[1] != -1 && dist_to_side + input.obstacles[1] <= outer_length / 2)
+        return;
+
+    int first_width = index.findPart(DIM_ID::WIDTH, request.approx_inner_dim[DIM_ID::WIDTH]);
+    int first_modules = index.findStack(request.approx_inner_dim[DIM_ID::HEIGHT], StackGoal::MIN_STACK_HEIGHT);
+
+    if(first_width == -1 || first_modules == -1)
+        return;
+
+    for(size_t w = first_width; w < inner_widths.size(); ++w)
+    {
+        if(input.obstacles[2] != -1)
+        {
+            int offset = inner_widths[w] / 2 - input.device[1] / 2 - input.spaces[2];
+
+            if(input.device[1] / 2 + input.obstacles[2] <= outer_widths[w] / 2 - offset)
+                continue;
+        }
+
+        uint64_t footprint = static_cast<uint64_t>(outer_length) * outer_widths[w];
+        bool first_accepted = false;
+
+        for(size_t n = first_modules; n < inner_heights.size(); ++n)
+        {
+            CoverCandidate candidate;
+            candidate.length_idx = length_idx;
+            candidate.width_idx = static_cast<int>(w);
+            candidate.modules = static_cast<uint8_t>(2 * stack_modules[n]);
+            candidate.inner_dim[DIM_ID::LENGTH] = inner_length;
+            candidate.inner_dim[DIM_ID::WIDTH] = inner_widths[w];
+            candidate.inner_dim[DIM_ID::HEIGHT] = inner_heights[n];
+            candidate.outer_dim[DIM_ID::LENGTH] = outer_length;
+            candidate.outer_dim[DIM_ID::WIDTH] = outer_widths[w];
+            candidate.outer_dim[DIM_ID::HEIGHT] = outer_heights[n];
+            candidate.score = (goal == OptimizerGoal::MIN_VOLUME) ? footprint * outer_heights[n] : footprint;
+            // Kopiec z najgorszym kandydatem na początku
+            if(best.size() == top_k)
+            {
+                if(!isBetter(candidate, best.front()))
+                {
+                    // Przy równym wyniku wyższy stos może mieć mniej modułów
+                    if(candidate.score > best.front().score)
+                        break;
+
+                    continue;
+                }
+
+                std::pop_heap(best.begin(), best.end(), isBetter);
+                best.back() = candidate;
+            }
+            else
+                best.push_back(candidate);
+
+            std::push_heap(best.begin(), best.end(), isBetter);
+            first_accepted = first_accepted || (n == static_cast<size_t>(first_modules));
+        }
+        // Głębsze obudowy nie mogą być lepsze
+        if(!first_accepted)
+            break;
+    }
+}
@@ -0,0 +1,579 @@
+#include "CoverSizer.hpp"
+
+/*!
+ * \brief Initialization of the class CoverSizer
+ *
+ * Generator uses the empty catalog until the loaded one is
+ * provided. Index of the empty catalog has negative maximum
+ * dimensions, so every cover is reported as too large.
+ */
+CoverSizer::CoverSizer() : catalog(std::make_shared<const CoverCatalog>())
+{
+
+}
+/*!
+ * \brief Initialization of the class CoverSizer with the given parts library
+ *
+ * \param[in] parts - parts library loaded by the caller
+ */
+CoverSizer::CoverSizer(CatalogPtr parts) : CoverSizer()
+{
+    setCatalog(parts);
+}
+/*!
+ * \brief Replace the parts library used by the generator
+ *
+ * Catalog is shared, not copied. It must not be replaced while
+ * other threads are generating covers with this object.
+ *
+ * \param[in] parts - parts library loaded by the caller (ignored if empty)
+ */
+void CoverSizer::setCatalog(CatalogPtr parts)
+{
+    if(parts)
+        catalog = parts;
+}
+/*!
+ * \brief Generate the cover
+ *
+ * Copy the inputs from the user to the result of the request.
+ * Then count all inner dimensions and check if they exceed the
+ * limits. If not, look up the parts that match to the calculated
+ * inner dimensions in the index of the catalog (sorted and prepared
+ * once, when the catalog has been loaded). If parts have been found,
+ * determine the exact inner and outer dimensions of the cover. If the
+ * cover has been correctly generated, determine the collisions with
+ * the nearby obstacles (if present). Whole state of the request is
+ * kept in the result, so the method can be called concurrently.
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if generated, false if not
+ */
+bool CoverSizer::generateCover(const SizingInput & dimensions, SizingResult & result) const
+{
+    // Nowy stan zapytania (możliwość aktualizowania wyników)
+    result = SizingResult();
+    result.input = dimensions;
+
+    // Obliczenia wszystkich POTRZEBNYCH wymiarów wewnętrznych
+    bool length_correct = countInnerLength(result);
+    bool width_correct = countInnerWidth(result);
+    bool height_correct = countInnerHeight(result);
+
+    if(!length_correct)
+        result.error = GenErrors::TOO_LONG;
+    else if(!width_correct)
+        result.error = GenErrors::TOO_WIDE;
+    else if(!height_correct)
+        result.error = GenErrors::TOO_HIGH;
+
+    if(!(length_correct & width_correct & height_correct))
+        return false;
+    // Przeszukanie bilbioteki części
+    if(!searchPartsLibrary(result))
+        return false;
+    // Obliczenie wymiarów zewnętrznych wygenerowanej obudowy
+    countOuterDimensions(result);
+
+    // Sprawdzenie kolizji z ewentualnymi przeszkodami
+    bool no_left_collision = checkForLengthCollision(result, result.input.obstacles[0]);
+    bool no_right_collision = checkForLengthCollision(result, result.input.obstacles[1]);
+    bool no_back_collision = checkForWidthCollision(result, result.input.obstacles[2]);
+
+    if(!no_left_collision)
+        result.error = GenErrors::LEFT_COLLISION;
+    else if(!no_right_collision)
+        result.error = GenErrors::RIGHT_COLLISION;
+    else if(!no_back_collision)
+        result.error = GenErrors::BACK_COLLISION;
+
+    if(!(no_left_collision & no_right_collision & no_back_collision))
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Generate the cover again after the change of the input data
+ *
+ * Compare the input data (with resolved default spaces) with the
+ * data of the previous request kept in the state and compute again
+ * only the nodes of the dependency graph, which depend on the changed
+ * values. For example, the change of the distance to the obstacle on
+ * the left repeats only the check of this collision. Whole graph is
+ * computed for the first request and after the change of the catalog,
+ * the remembered result is returned if nothing has changed. Result
+ * is the same as the one of generateCover.
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[in,out] state - values of the previous request (owned by the caller)
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if generated, false if not
+ */
+bool CoverSizer::updateCover(const SizingInput & dimensions, SizingState & state, SizingResult & result) const
+{
+    SizingInput resolved = dimensions;
+    catalog->returnIndex().resolveDefaults(resolved);
+
+    uint16_t dirty = SizingGraph::AllNodes;
+
+    if(state.catalog == catalog)
+        dirty = SizingGraph::dirtyNodes(SizingGraph::changedInputs(state.values.input, resolved));
+    else
+        state.catalog = catalog;
+
+    state.recomputed = dirty;
+    // Te same dane (np. zmiana innego pola formularza)
+    if(dirty == 0)
+    {
+        result = state.result;
+        return result.error == GenErrors::COVER_OK;
+    }
+
+    state.values.input = resolved;
+    // Węzły w kolejności topologicznej (od najmłodszego bitu)
+    while(dirty)
+    {
+        evaluateNode(static_cast<SIZING_NODE>(__builtin_ctz(dirty)), state);
+        dirty &= dirty - 1;
+    }
+
+    bool generated = assembleResult(state, state.result);
+    result = state.result;
+
+    return generated;
+}
+/*!
+ * \brief Move the device inside the cover to avoid the collision on the left or right
+ *
+ * Used after generateCover or updateCover, if the centered cover hits
+ * the obstacle on the left or right. Device is moved within the minimal
+ * side spaces by the smallest distance, which avoids both obstacles
+ * (PlacementSearch), then the obstacle behind is checked as before
+ * (it does not depend on the shift). Other results are not changed.
+ *
+ * \param[in,out] result - result of the generator (shift and error updated)
+ * \return True if the standard cover can be placed and false otherwise
+ */
+bool CoverSizer::placeOffCenter(SizingResult & result) const
+{
+    if(result.error != GenErrors::LEFT_COLLISION && result.error != GenErrors::RIGHT_COLLISION)
+        return result.error == GenErrors::COVER_OK;
+
+    int shift = 0;
+    GenErrors error = PlacementSearch::placeLength(result.input.device[0], result.inner_dim[0], result.outer_dim[0],
+                                                   result.input.spaces[0], result.input.obstacles[0],
+                                                   result.input.obstacles[1], shift);
+
+    if(error == GenErrors::COVER_OK && !checkForWidthCollision(result, result.input.obstacles[2]))
+        error = GenErrors::BACK_COLLISION;
+
+    result.error = error;
+    result.shift = (error == GenErrors::COVER_OK) ? static_cast<int16_t>(shift) : 0;
+
+    return error == GenErrors::COVER_OK;
+}
+/*!
+ * \brief Size the device rotated by 90 degrees and keep the better orientation
+ *
+ * Used after generateCover or updateCover (and placeOffCenter). Width
+ * and depth of the device are swapped, while the obstacles and inner
+ * spaces stay at the same sides of the cover. If the rotated device
+ * fits the standard cover and the typed one does not (or needs the larger
+ * footprint), the result of the rotated device replaces the given one.
+ *
+ * \param[in,out] result - result of the typed orientation (replaced if the rotated device is better)
+ * \param[in] off_center - true if the rotated device can be placed off-center too
+ * \return True if the standard cover has been generated in any orientation
+ */
+bool CoverSizer::exploreRotation(SizingResult & result, bool off_center) const
+{
+    // Kwadratowe urządzenie - obrót niczego nie zmienia
+    if(result.input.device[0] == result.input.device[1])
+        return result.error == GenErrors::COVER_OK;
+
+    SizingInput rotated_input = result.input;
+    rotated_input.device[0] = result.input.device[1];
+    rotated_input.device[1] = result.input.device[0];
+
+    SizingResult rotated;
+
+    if(!generateCover(rotated_input, rotated) && off_center)
+        placeOffCenter(rotated);
+
+    uint32_t typed_footprint = static_cast<uint32_t>(result.outer_dim[0]) * result.outer_dim[1];
+    uint32_t rotated_footprint = static_cast<uint32_t>(rotated.outer_dim[0]) * rotated.outer_dim[1];
+
+    if(isRotationBetter(result.error, typed_footprint, rotated.error, rotated_footprint))
+    {
+        result = rotated;
+        result.rotated = true;
+    }
+
+    return result.error == GenErrors::COVER_OK;
+}
+/*!
+ * \brief Compute one node of the dependency graph
+ *
+ * Nodes are computed without the early exits of the full generation
+ * (e.g. part is looked up also for the too high cover), so each of
+ * them is valid for any later request. Values of the nodes, which
+ * could not be made (part not found), are ignored by assembleResult.
+ *
+ * \param[in] node - computed node
+ * \param[in,out] state - values of all nodes
+ */
+void CoverSizer::evaluateNode(SIZING_NODE node, SizingState & state) const
+{
+    SizingResult & values = state.values;
+
+    switch(node)
+    {
+        case INNER_LENGTH:
+            state.dim_correct[DIM_ID::LENGTH] = countInnerLength(values);
+            break;
+        case INNER_WIDTH:
+            state.dim_correct[DIM_ID::WIDTH] = countInnerWidth(values);
+            break;
+        case INNER_HEIGHT:
+            state.dim_correct[DIM_ID::HEIGHT] = countInnerHeight(values);
+            break;
+        case PART_LENGTH:
+            state.found_parts[DIM_ID::LENGTH] = pickRightDimension(values, DIM_ID::LENGTH);
+            break;
+        case PART_WIDTH:
+            state.found_parts[DIM_ID::WIDTH] = pickRightDimension(values, DIM_ID::WIDTH);
+            break;
+        case PART_HEIGHT:
+            state.found_parts[DIM_ID::HEIGHT] = pickRightModulesQuantity(values);
+            break;
+        case OUTER_LENGTH:
+        case OUTER_WIDTH:
+        case OUTER_HEIGHT:
+        {
+            uint8_t dim_idx = node - OUTER_LENGTH;
+            values.outer_dim[dim_idx] = truncToMm(toFixed(values.inner_dim[dim_idx]) + catalog->returnOuterCorrection(static_cast<DIM_ID>(dim_idx)));
+            break;
+        }
+        case LEFT_CHECK:
+            state.no_collision[0] = checkForLengthCollision(values, values.input.obstacles[0]);
+            break;
+        case RIGHT_CHECK:
+            state.no_collision[1] = checkForLengthCollision(values, values.input.obstacles[1]);
+            break;
+        case BACK_CHECK:
+            state.no_collision[2] = checkForWidthCollision(values, values.input.obstacles[2]);
+            break;
+    }
+}
+/*!
+ * \brief Build the result of the generator from the values of all nodes
+ *
+ * Follows the order of the full generation, so the reported error
+ * and the filled dimensions are the same as in generateCover.
+ *
+ * \param[in] state - values of all nodes
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if generated, false if not
+ */
+bool CoverSizer::assembleResult(const SizingState & state, SizingResult & result) const
+{
+    const SizingResult & values = state.values;
+
+    result = SizingResult();
+    result.input = values.input;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        result.approx_inner_dim[i] = values.approx_inner_dim[i];
+
+    if(!state.dim_correct[DIM_ID::LENGTH])
+        result.error = GenErrors::TOO_LONG;
+    else if(!state.dim_correct[DIM_ID::WIDTH])
+        result.error = GenErrors::TOO_WIDE;
+    else if(!state.dim_correct[DIM_ID::HEIGHT])
+        result.error = GenErrors::TOO_HIGH;
+
+    if(result.error != GenErrors::COVER_OK)
+        return false;
+    // Wymiary znalezionych części (jak w searchPartsLibrary)
+    for(uint8_t i = 0; i < DIM_ID::HEIGHT; ++i)
+    {
+        if(state.found_parts[i] != -1)
+            result.inner_dim[i] = values.inner_dim[i];
+    }
+
+    if(state.found_parts[DIM_ID::LENGTH] == -1)
+        result.error = GenErrors::NO_PART_LENGTH;
+    else if(state.found_parts[DIM_ID::WIDTH] == -1)
+        result.error = GenErrors::NO_PART_WIDTH;
+    else if(state.found_parts[DIM_ID::HEIGHT] == -1)
+        result.error = GenErrors::TOO_HIGH;
+
+    if(result.error != GenErrors::COVER_OK)
+        return false;
+
+    result.inner_dim[DIM_ID::HEIGHT] = values.inner_dim[DIM_ID::HEIGHT];
+    result.modules = state.found_parts[DIM_ID::HEIGHT];
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        result.outer_dim[i] = values.outer_dim[i];
+
+    if(!state.no_collision[0])
+        result.error = GenErrors::LEFT_COLLISION;
+    else if(!state.no_collision[1])
+        result.error = GenErrors::RIGHT_COLLISION;
+    else if(!state.no_collision[2])
+        result.error = GenErrors::BACK_COLLISION;
+
+    return result.error == GenErrors::COVER_OK;
+}
+/*!
+ * \brief Calculate the required width
+ *
+ * First, determine the maximum width of the cover based on the
+ * available parts. Then, calculate the required width with addition
+ * of the left and right inner spaces between cover and heat pump (from the user or
+ * default if not given). Check if it exceeds the limit. If so, return
+ * false (required cover is too wide).
+ *
+ * \param[in,out] result - state of the request
+ * \return True when value is lower than the max threshold and false otherwise
+ */
+bool CoverSizer::countInnerLength(SizingResult & result) const
+{
+    const CatalogIndex & index = catalog->returnIndex();
+
+    int max_length = index.returnMaxDim(DIM_ID::LENGTH);
+    // Dodanie domyślnej wartości odstępu od boków wewnątrz
+    // jeżeli użytkownik nie podał tej zmiennej (wpisane 0).
+    result.input.spaces[0] = (result.input.spaces[0] == -1) ? index.returnDefaultSpace(0) : result.input.spaces[0];
+
+    result.approx_inner_dim[0] = result.input.device[0] + 2 * result.input.spaces[0];
+
+    if(result.approx_inner_dim[0] > max_length)
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Calculate the required depth
+ *
+ * First, determine the maximum depth of the cover based on the
+ * available parts. Then, calculate the required depth with addition
+ * of the front and back inner spaces between cover and heat pump (from the user or
+ * default if not given). Check if it exceeds the limit. If so, return
+ * false (required cover is too deep).
+ *
+ * \param[in,out] result - state of the request
+ * \return True when value is lower than the max threshold and false otherwise
+ */
+bool CoverSizer::countInnerWidth(SizingResult & result) const
+{
+    const CatalogIndex & index = catalog->returnIndex();
+
+    int max_width = index.returnMaxDim(DIM_ID::WIDTH);
+    // Obliczenie wymiaru wewnętrznego i ustalenie typu obudowy
+    // zależnie od odległości z tyłu (do eleweacji).
+    result.input.spaces[1] = (result.input.spaces[1] == -1) ? index.returnDefaultSpace(1) : result.input.spaces[1];
+    result.input.spaces[2] = (result.input.spaces[2] == -1) ? index.returnDefaultSpace(2) : result.input.spaces[2];
+
+    result.approx_inner_dim[1] = result.input.device[1] + result.input.spaces[1] + result.input.spaces[2];
+
+    if(result.approx_inner_dim[1] > max_width)
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Calculate the required height
+ *
+ * First, determine the maximum height of the cover based on the
+ * available parts and maximum number of wall modules. Then, calculate
+ * the required height with addition of the top inner space
+ * between cover and heat pump (from the user or default if not given).
+ * Check if it exceeds the limit. If so, return false (required cover is
+ * too high).
+ *
+ * \param[in,out] result - state of the request
+ * \return True when value is lower than the max threshold and false otherwise
+ */
+bool CoverSizer::countInnerHeight(SizingResult & result) const
+{
+    const CatalogIndex & index = catalog->returnIndex();
+
+    int max_height = index.returnMaxDim(DIM_ID::HEIGHT);
+
+    result.input.spaces[3] = (result.input.spaces[3] == -1) ? index.returnDefaultSpace(3) : result.input.spaces[3];
+
+    result.approx_inner_dim[2] = result.input.device[2] + result.input.spaces[3];
+
+    if(result.approx_inner_dim[2] > max_height)
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Calculate the precise outer dimensions of the generated cover
+ *
+ * Outer dimension is the addition of the inner dimension calculated
+ * from the rounded parts dimensions and the precise values (corrections)
+ * from the CAD program. Sum is calculated in the fixed-point format and
+ * truncated to millimetres.
+ *
+ * \param[in,out] result - state of the request
+ */
+void CoverSizer::countOuterDimensions(SizingResult & result) const
+{
+    for(uint8_t i = 0; i < DimNum; ++i)
+        result.outer_dim[i] = truncToMm(toFixed(result.inner_dim[i]) + catalog->returnOuterCorrection(static_cast<DIM_ID>(i)));
+}
+/*!
+ * \brief Check if there is a collision with the object on the left or right
+ *
+ * If distance to the obstacle is not given (-1), return true (no collision).
+ * Compare the half of the outer width of the cover with the distance to
+ * the obstacle from the center of the heat pump (assuming that centers of the
+ * cover and device will be aligned vertically.) Halves are calculated with
+ * the integer division, as in the original generator.
+ *
+ * \param[in] result - state of the request with the outer dimensions
+ * \param[in] constraint - distance to the obstacle typed by the user
+ * \return True for collision and false otherwise
+ */
+bool CoverSizer::checkForLengthCollision(const SizingResult & result, int constraint) const
+{
+    if(constraint == -1)
+        return true;
+
+    int cover_outer_dim = result.outer_dim[0];
+    int dimension = result.input.device[0];
+    int half_cover_dim = cover_outer_dim / 2;
+    int dist_to_obstacle = dimension / 2 + constraint;
+
+    if(dist_to_obstacle <= half_cover_dim)
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Check if there is a collision with the object behind the device
+ *
+ * If distance to the obstacle is not given (-1), return true (no collision).
+ * Compare the half of the outer depth of the cover with the distance to
+ * the obstacle from the center of the heat pump. Device and cover do not have
+ * to be algined, the front and back inner spaces are taken into account.
+ * Halves are calculated with the integer division.
+ *
+ * \param[in] result - state of the request with the outer dimensions
+ * \param[in] constraint - distance to the obstacle typed by the user
+ * \return True for collision and false otherwise
+ */
+bool CoverSizer::checkForWidthCollision(const SizingResult & result, int constraint) const
+{
+    if(constraint == -1)
+        return true;
+
+    int cover_outer_dim = result.outer_dim[1];
+    int dimension = result.input.device[1];
+    int dist_to_obstacle = dimension / 2 + constraint;
+
+    int offset = result.inner_dim[1] / 2 - dimension / 2 - result.input.spaces[2];
+    int half_cover_dim = cover_outer_dim / 2 - offset;
+
+    if(dist_to_obstacle <= half_cover_dim)
+        return false;
+
+    return true;
+}
+/*!
+ * \brief Check if the required dimensions can be provided by the available parts
+ *
+ * Find the available width and depth of the cover for the required
+ * inner dimensions (from the user). If returend index is -1, then it
+ * means that the part has not been found and the appropriate error is
+ * raised. If both width and depth are available, calculate how many wall
+ * modules of the standard cover is necessary.
+ *
+ * \param[in,out] result - state of the request
+ * \return True if standard cover can be made and false otherwise (too large)
+ */
+bool CoverSizer::searchPartsLibrary(SizingResult & result) const
+{
+    // Znajdź pasującą długość i szerokość i zaktualizuj wymiary wewnętrzne
+    int available_length = pickRightDimension(result, DIM_ID::LENGTH);
+    int available_width = pickRightDimension(result, DIM_ID::WIDTH);
+    // Nie da się wygenerować obudowy standardowej
+    if(available_length == -1)
+    {
+        result.error = GenErrors::NO_PART_LENGTH;
+        return false;
+    }
+    if(available_width == -1)
+    {
+        result.error = GenErrors::NO_PART_WIDTH;
+        return false;
+    }
+    // Znajdź ilość potrzebnych modułów i zaktualizuj wysokość wewnętrzną
+    int modules_pcs = pickRightModulesQuantity(result);
+
+    if(modules_pcs == -1)
+    {
+        result.error = GenErrors::TOO_HIGH;
+        return false;
+    }
+
+    result.modules = modules_pcs;
+
+    return true;
+}
+/*!
+ * \brief Find the base dimension available for the approximated one
+ *
+ * Look up the first part, which precise dimension (given by the input
+ * argument 'dim_idx') is greater than or equal to dimension calculated
+ * from the input data provided by the user. The first-fit table of the
+ * catalog index answers in constant time, independently of the number
+ * of the available parts.
+ *
+ * \param[in,out] result - state of the request
+ * \param[in] dim_idx - required dimension (enumeration)
+ * \return Index of the found part in the catalog or -1 if not found
+ */
+int CoverSizer::pickRightDimension(SizingResult & result, DIM_ID dim_idx) const
+{
+    const CatalogIndex & index = catalog->returnIndex();
+
+    // Znajdź pierwszy pasujący wymiar - długość lub szerokość
+    int found_part = index.findPart(dim_idx, result.approx_inner_dim[dim_idx]);
+    // Zapisanie oficjalnego wyniku
+    if(found_part != -1)
+        result.inner_dim[dim_idx] = index.returnInnerDims(dim_idx)[found_part];
+
+    return found_part;
+}
+/*!
+ * \brief Choose the appropriate number of the wall modules to the required height
+ *
+ * Find the stack of the wall modules, which raises the minimum
+ * height of the cover (base and top modules) to at least the height
+ * required by the user - the lowest one or the one with the fewest
+ * modules, as chosen by the catalog. The stack is read from the
+ * catalog index in constant time. At the end update the precise
+ * inner height of the cover.
+ *
+ * \param[in,out] result - state of the request
+ * \return Total number of the wall modules (for both walls) or -1 if not available
+ */
+int CoverSizer::pickRightModulesQuantity(SizingResult & result) const
+{
+    const CatalogIndex & index = catalog->returnIndex();
+
+    int stack_idx = index.findStack(result.approx_inner_dim[DIM_ID::HEIGHT]);
+
+    if(stack_idx == -1)
+        return -1;
+    // Zapisanie oficjalnego wyniku
+    result.inner_dim[DIM_ID::HEIGHT] = index.returnInnerHeights()[stack_idx];
+
+    return index.returnStackModules()[stack_idx] * 2;
+}
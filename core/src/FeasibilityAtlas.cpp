@@ -0,0 +1,281 @@
+#include "FeasibilityAtlas.hpp"
+
+/*!
+ * \brief Build the atlas from the generator
+ *
+ * Evaluate the generator along the whole range of each axis and
+ * keep only the ranges with the same answer. Then build the bucket
+ * tables with the requested resolution (narrowed, if any range is
+ * shorter than it).
+ *
+ * \param[in] sizer - generator with the loaded catalog
+ * \param[in] resolution - requested width of the buckets in millimetres
+ * \return True if built and false otherwise (catalog without any cover)
+ */
+bool FeasibilityAtlas::build(const CoverSizer & sizer, int resolution)
+{
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        default_spaces[i] = index.returnDefaultSpace(i);
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        DIM_ID axis = static_cast<DIM_ID>(i);
+
+        if(!buildAxis(sizer, axis))
+            return false;
+
+        buildBuckets(axis, (resolution > 0) ? resolution : 1);
+    }
+
+    return true;
+}
+/*!
+ * \brief Evaluate the generator along one axis and store the ranges
+ *
+ * The device has zero dimensions on the other axes, inner spaces are
+ * zero and there are no obstacles, so the required dimension equals
+ * the dimension of the device on the evaluated axis and the error can
+ * be caused only by this axis. Height above the limit and height without
+ * the modules give the same error, so they are told apart by the maximum
+ * height of the catalog.
+ *
+ * \param[in] sizer - generator with the loaded catalog
+ * \param[in] axis - evaluated dimension
+ * \return True if the other axes accept the zero dimension and false otherwise
+ */
+bool FeasibilityAtlas::buildAxis(const CoverSizer & sizer, DIM_ID axis)
+{
+    const GenErrors too_large[DimNum] = { GenErrors::TOO_LONG, GenErrors::TOO_WIDE, GenErrors::TOO_HIGH };
+    const GenErrors no_part[DimNum] = { GenErrors::NO_PART_LENGTH, GenErrors::NO_PART_WIDTH, GenErrors::TOO_HIGH };
+    int max_height = sizer.returnCatalog().returnIndex().returnMaxDim(DIM_ID::HEIGHT);
+
+    SizingInput probe = { {0, 0, 0}, {-1, -1, -1}, {0, 0, 0, 0} };
+    SizingResult result;
+
+    runs[axis].clear();
+
+    for(int required = 0; required <= MaxRequired; ++required)
+    {
+        probe.device[axis] = required;
+        sizer.generateCover(probe, result);
+
+        AtlasRun run;
+        run.begin = required;
+
+        if(result.error == GenErrors::COVER_OK)
+        {
+            run.status = ATLAS_PART_FOUND;
+            run.inner_dim = result.inner_dim[axis];
+            run.outer_dim = result.outer_dim[axis];
+            run.modules = (axis == DIM_ID::HEIGHT) ? result.modules : 0;
+        }
+        else if(result.error == too_large[axis] && (axis != DIM_ID::HEIGHT || required > max_height))
+            run.status = ATLAS_TOO_LARGE;
+        else if(result.error == no_part[axis])
+            run.status = ATLAS_NO_PART;
+        else
+            return false;
+        // Nowy zakres tylko przy zmianie odpowiedzi
+        if(!runs[axis].empty())
+        {
+            const AtlasRun & last = runs[axis].back();
+
+            if(last.status == run.status && last.modules == run.modules &&
+               last.inner_dim == run.inner_dim && last.outer_dim == run.outer_dim)
+                continue;
+        }
+
+        runs[axis].push_back(run);
+    }
+
+    return true;
+}
+/*!
+ * \brief Build the bucket table of one axis
+ *
+ * Bucket points to the range containing its beginning. If every range
+ * is at least as long as the bucket, bucket contains at most one
+ * beginning of the next range, so the lookup checks at most two ranges.
+ *
+ * \param[in] axis - dimension of the table
+ * \param[in] resolution - requested width of the buckets
+ */
+void FeasibilityAtlas::buildBuckets(DIM_ID axis, int resolution)
+{
+    const std::vector<AtlasRun> & axis_runs = runs[axis];
+    int width = resolution;
+
+    for(size_t i = 0; i + 1 < axis_runs.size(); ++i)
+    {
+        int length = axis_runs[i + 1].begin - axis_runs[i].begin;
+        width = (length < width) ? length : width;
+    }
+
+    bucket_width[axis] = width;
+    buckets[axis].clear();
+
+    size_t run = 0;
+
+    for(int start = 0; start <= axis_runs.back().begin; start += width)
+    {
+        while(run + 1 < axis_runs.size() && axis_runs[run + 1].begin <= start)
+            ++run;
+
+        buckets[axis].push_back(static_cast<uint16_t>(run));
+    }
+}
+/*!
+ * \brief Find the range containing the required dimension
+ *
+ * \param[in] axis - required dimension (enumeration)
+ * \param[in] required - required inner dimension
+ * \return Constant reference to the range
+ */
+const AtlasRun & FeasibilityAtlas::findRun(DIM_ID axis, int required) const
+{
+    const std::vector<AtlasRun> & axis_runs = runs[axis];
+
+    if(required >= axis_runs.back().begin)
+        return axis_runs.back();
+
+    size_t run = buckets[axis][required / bucket_width[axis]];
+
+    if(axis_runs[run + 1].begin <= required)
+        ++run;
+
+    return axis_runs[run];
+}
+/*!
+ * \brief Answer the request without running the generator
+ *
+ * Calculate the required inner dimensions in the same way as the
+ * generator, take the ranges of all axes and report the error with
+ * the same priority. Result is the same as the one of generateCover.
+ * Atlas, which has not been built, reports every cover as too long.
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if generated, false if not
+ */
+bool FeasibilityAtlas::lookup(const SizingInput & dimensions, SizingResult & result) const
+{
+    result = SizingResult();
+    result.input = dimensions;
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        result.input.spaces[i] = (result.input.spaces[i] == -1) ? default_spaces[i] : result.input.spaces[i];
+
+    const SizingInput & input = result.input;
+    // Atlas jeszcze nie zbudowany (jak pusty katalog)
+    if(runs[DIM_ID::LENGTH].empty())
+    {
+        result.error = GenErrors::TOO_LONG;
+        return false;
+    }
+
+    result.approx_inner_dim[0] = input.device[0] + 2 * input.spaces[0];
+    result.approx_inner_dim[1] = input.device[1] + input.spaces[1] + input.spaces[2];
+    result.approx_inner_dim[2] = input.device[2] + input.spaces[3];
+
+    const AtlasRun & length = findRun(DIM_ID::LENGTH, result.approx_inner_dim[0]);
+    const AtlasRun & width = findRun(DIM_ID::WIDTH, result.approx_inner_dim[1]);
+    const AtlasRun & height = findRun(DIM_ID::HEIGHT, result.approx_inner_dim[2]);
+
+    if(length.status == ATLAS_TOO_LARGE)
+        result.error = GenErrors::TOO_LONG;
+    else if(width.status == ATLAS_TOO_LARGE)
+        result.error = GenErrors::TOO_WIDE;
+    else if(height.status == ATLAS_TOO_LARGE)
+        result.error = GenErrors::TOO_HIGH;
+
+    if(result.error != GenErrors::COVER_OK)
+        return false;
+
+    if(length.status == ATLAS_PART_FOUND)
+        result.inner_dim[0] = length.inner_dim;
+    if(width.status == ATLAS_PART_FOUND)
+        result.inner_dim[1] = width.inner_dim;
+
+    if(length.status == ATLAS_NO_PART)
+        result.error = GenErrors::NO_PART_LENGTH;
+    else if(width.status == ATLAS_NO_PART)
+        result.error = GenErrors::NO_PART_WIDTH;
+    else if(height.status == ATLAS_NO_PART)
+        result.error = GenErrors::TOO_HIGH;
+
+    if(result.error != GenErrors::COVER_OK)
+        return false;
+
+    result.inner_dim[2] = height.inner_dim;
+    result.outer_dim[0] = length.outer_dim;
+    result.outer_dim[1] = width.outer_dim;
+    result.outer_dim[2] = height.outer_dim;
+    result.modules = height.modules;
+    // Kolizje - te same wzory co w generatorze
+    int dist_to_side = input.device[0] / 2;
+    int offset = result.inner_dim[1] / 2 - input.device[1] / 2 - input.spaces[2];
+
+    if(input.obstacles[0] != -1 && dist_to_side + input.obstacles[0] <= result.outer_dim[0] / 2)
+        result.error = GenErrors::LEFT_COLLISION;
+    else if(input.obstacles[1] != -1 && dist_to_side + input.obstacles[1] <= result.outer_dim[0] / 2)
+        result.error = GenErrors::RIGHT_COLLISION;
+    else if(input.obstacles[2] != -1 && input.device[1] / 2 + input.obstacles[2] <= result.outer_dim[1] / 2 - offset)
+        result.error = GenErrors::BACK_COLLISION;
+
+    return result.error == GenErrors::COVER_OK;
+}
+/*!
+ * \brief Write the atlas in the JSON format
+ *
+ * Every axis is written as the list of ranges [begin, status, modules,
+ * inner, outer] and the bucket table, so the lookup can be repeated
+ * by the website without the generator.
+ *
+ * \param[in] stream - output stream
+ */
+void FeasibilityAtlas::writeJson(std::ostream & stream) const
+{
+    const char *axis_names[DimNum] = { "length", "width", "height" };
+
+    stream << "{\n  \"default_spaces\": [";
+    for(uint8_t i = 0; i < DevSides; ++i)
+        stream << (i ? ", " : "") << default_spaces[i];
+    stream << "],\n  \"axes\": {\n";
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        stream << "    \"" << axis_names[i] << "\": {\n      \"runs\": [";
+
+        for(size_t r = 0; r < runs[i].size(); ++r)
+        {
+            const AtlasRun & run = runs[i][r];
+            stream << (r ? ", " : "") << "[" << run.begin << ", " << static_cast<int>(run.status) << ", "
+                   << static_cast<int>(run.modules) << ", " << run.inner_dim << ", " << run.outer_dim << "]";
+        }
+
+        stream << "],\n      \"bucket_width\": " << bucket_width[i] << ",\n      \"buckets\": [";
+
+        for(size_t b = 0; b < buckets[i].size(); ++b)
+            stream << (b ? ", " : "") << buckets[i][b];
+
+        stream << "]\n    }" << ((i + 1 < DimNum) ? "," : "") << "\n";
+    }
+
+    stream << "  }\n}\n";
+}
+/*!
+ * \brief Return memory used by the tables
+ *
+ * \return Number of bytes of the ranges and buckets
+ */
+size_t FeasibilityAtlas::returnBytes() const
+{
+    size_t bytes = 0;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        bytes += runs[i].size() * sizeof(AtlasRun) + buckets[i].size() * sizeof(uint16_t);
+
+    return bytes;
+}
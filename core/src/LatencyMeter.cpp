@@ -0,0 +1,129 @@
+#include "LatencyMeter.hpp"
+#include <algorithm>
+
+/*!
+ * \brief Initialization of the class LatencyMeter
+ *
+ * \param[in] budget - latency budget in nanoseconds (0 - no budget)
+ * \param[in] window - number of the last samples used for the percentiles
+ */
+LatencyMeter::LatencyMeter(uint64_t budget, size_t window) : samples(window ? window : 1, 0), budget_ns(budget)
+{
+
+}
+/*!
+ * \brief Add the duration of one call
+ *
+ * \param[in] duration_ns - duration in nanoseconds
+ * \return True if the sample fits in the budget and false otherwise
+ */
+bool LatencyMeter::addSample(uint64_t duration_ns)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    samples[next_sample] = duration_ns;
+    next_sample = (next_sample + 1) % samples.size();
+    ++count;
+    max_ns = std::max(max_ns, duration_ns);
+
+    bool in_budget = (budget_ns == 0) || (duration_ns <= budget_ns);
+    over_budget += !in_budget;
+
+    return in_budget;
+}
+/*!
+ * \brief Add the time elapsed since the given moment
+ *
+ * \param[in] start - moment of the beginning of the call
+ * \return True if the sample fits in the budget and false otherwise
+ */
+bool LatencyMeter::addSince(std::chrono::steady_clock::time_point start)
+{
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return addSample(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+/*!
+ * \brief Return the percentile of the samples in the window
+ *
+ * Copy of the window is partially sorted, so the samples are
+ * not reordered and can be still added by other threads.
+ *
+ * \param[in] fraction - percentile as the fraction (e.g. 0.99)
+ * \return Value of the percentile in nanoseconds (0 if there are no samples)
+ */
+uint64_t LatencyMeter::returnPercentile(double fraction) const
+{
+    std::vector<uint64_t> window;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        size_t filled = (count < samples.size()) ? static_cast<size_t>(count) : samples.size();
+        window.assign(samples.begin(), samples.begin() + filled);
+    }
+
+    if(window.empty())
+        return 0;
+
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+    size_t rank = static_cast<size_t>(fraction * (window.size() - 1) + 0.5);
+    std::nth_element(window.begin(), window.begin() + rank, window.end());
+
+    return window[rank];
+}
+/*!
+ * \brief Return the last sample
+ *
+ * \return Duration in nanoseconds (0 if there are no samples)
+ */
+uint64_t LatencyMeter::returnLast() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    if(count == 0)
+        return 0;
+
+    return samples[(next_sample + samples.size() - 1) % samples.size()];
+}
+/*!
+ * \brief Return the longest sample
+ *
+ * \return Duration in nanoseconds
+ */
+uint64_t LatencyMeter::returnMax() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return max_ns;
+}
+/*!
+ * \brief Return number of all samples
+ *
+ * \return Number of samples
+ */
+uint64_t LatencyMeter::returnCount() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return count;
+}
+/*!
+ * \brief Return number of samples above the budget
+ *
+ * \return Number of samples
+ */
+uint64_t LatencyMeter::returnOverBudget() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return over_budget;
+}
+/*!
+ * \brief Drop all samples and counters
+ */
+void LatencyMeter::reset()
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    std::fill(samples.begin(), samples.end(), 0);
+    next_sample = 0;
+    count = 0;
+    over_budget = 0;
+    max_ns = 0;
+}
@@ -0,0 +1,60 @@
+#include "PlacementSearch.hpp"
+
+/*!
+ * \brief Find the smallest shift of the device, which avoids the obstacles on the sides
+ *
+ * Shift is positive if the device is moved to the right side of the
+ * cover (the cover is moved to the left on the site). Conditions are
+ * the same as in the centered check of CoverSizer (halves calculated
+ * with the integer division), so the zero shift gives the same result.
+ * Obstacle, which cannot be avoided even with the largest shift, is
+ * reported first (left before right), obstacles on both sides closer
+ * than the cover allows are reported as the collision on the left.
+ *
+ * \param[in] device - width of the device
+ * \param[in] inner - inner width of the cover
+ * \param[in] outer - outer width of the cover
+ * \param[in] side_space - minimal space between the device and the side of the cover
+ * \param[in] left - distance to the obstacle on the left (-1 if not given)
+ * \param[in] right - distance to the obstacle on the right (-1 if not given)
+ * \param[out] shift - smallest shift of the device (0 if not found)
+ * \return COVER_OK if found, LEFT_COLLISION or RIGHT_COLLISION otherwise
+ */
+GenErrors PlacementSearch::placeLength(int device, int inner, int outer, int side_space, int left, int right, int & shift)
+{
+    // Przesunięcie ograniczone minimalnymi odstępami po obu stronach
+    int slack = (inner - device - 2 * side_space) / 2;
+    slack = (slack > 0) ? slack : 0;
+
+    int lowest = -slack;
+    int highest = slack;
+
+    shift = 0;
+
+    if(left != -1)
+    {
+        int left_limit = device / 2 + left - outer / 2 - 1;
+
+        if(left_limit < lowest)
+            return GenErrors::LEFT_COLLISION;
+
+        highest = (left_limit < highest) ? left_limit : highest;
+    }
+
+    if(right != -1)
+    {
+        int right_limit = outer / 2 - device / 2 - right + 1;
+
+        if(right_limit > slack)
+            return GenErrors::RIGHT_COLLISION;
+
+        lowest = (right_limit > lowest) ? right_limit : lowest;
+    }
+
+    if(lowest > highest)
+        return GenErrors::LEFT_COLLISION;
+    // Najmniejsze przesunięcie (zero, jeżeli wyśrodkowana obudowa nie koliduje)
+    shift = (lowest > 0) ? lowest : (highest < 0) ? highest : 0;
+
+    return GenErrors::COVER_OK;
+}
@@ -0,0 +1,83 @@
+#include "ProductFamilies.hpp"
+
+/*!
+ * \brief Initialization of the class ProductFamilies
+ *
+ * \param[in] workers - pool used for the large number of families (nullptr - calling thread only)
+ */
+ProductFamilies::ProductFamilies(WorkStealingPool *workers) : pool(workers)
+{
+
+}
+/*!
+ * \brief Add the family or replace the catalog of the existing one
+ *
+ * Families are kept in the order of adding. Catalog must not be
+ * replaced while other threads are sizing the covers.
+ *
+ * \param[in] name - name of the family (product line)
+ * \param[in] parts - parts library of the family
+ * \return True if set and false otherwise (empty catalog)
+ */
+bool ProductFamilies::setFamily(const std::string & name, CatalogPtr parts)
+{
+    if(!parts)
+        return false;
+
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        if(names[i] == name)
+        {
+            sizers[i].setCatalog(parts);
+            return true;
+        }
+    }
+
+    names.push_back(name);
+    sizers.emplace_back(parts);
+
+    return true;
+}
+/*!
+ * \brief Size the cover for every family
+ *
+ * The same input data is sized with the catalog of every family.
+ * Default inner spaces are taken from each catalog separately.
+ * Groups of the families are sized by the tasks of the pool, if
+ * there is more than one group and more than one worker (sizing of
+ * one family takes tens of nanoseconds, so the smaller groups are
+ * sized faster in the calling thread).
+ *
+ * \param[in] dimensions - input data from the user
+ * \param[out] results - results of the generator for each family (in the order of adding)
+ * \return Number of the families with the standard cover
+ */
+size_t ProductFamilies::generateCovers(const SizingInput & dimensions, std::vector<SizingResult> & results) const
+{
+    results.resize(sizers.size());
+
+    size_t groups_num = (sizers.size() + FamiliesPerTask - 1) / FamiliesPerTask;
+    auto size_group = [&](size_t group)
+    {
+        size_t end = (group + 1) * FamiliesPerTask;
+        end = (end < sizers.size()) ? end : sizers.size();
+
+        for(size_t i = group * FamiliesPerTask; i < end; ++i)
+            sizers[i].generateCover(dimensions, results[i]);
+    };
+
+    if(pool != nullptr && pool->returnThreadsNum() > 1 && groups_num > 1)
+        pool->parallelFor(groups_num, size_group);
+    else
+    {
+        for(size_t group = 0; group < groups_num; ++group)
+            size_group(group);
+    }
+
+    size_t fitting = 0;
+
+    for(const SizingResult & result : results)
+        fitting += (result.error == GenErrors::COVER_OK);
+
+    return fitting;
+}
@@ -0,0 +1,108 @@
+#include "RelaxationSearch.hpp"
+
+/*!
+ * \brief Return the reference to the soft input data
+ *
+ * \param[in] input - input data of the generator
+ * \param[in] soft_input - soft input data (enumeration)
+ * \return Reference to the value in the input data
+ */
+int & RelaxationSearch::softValue(SizingInput & input, SOFT_INPUT soft_input)
+{
+    if(soft_input < LEFT_OBSTACLE)
+        return input.spaces[soft_input];
+
+    return input.obstacles[soft_input - LEFT_OBSTACLE];
+}
+/*!
+ * \brief Find the smallest changes of the soft input data giving the standard cover
+ *
+ * Default spaces are resolved at first, so the suggestion refers to
+ * the real values. If the data of the user already gives the standard
+ * cover, there are no changes. Obstacles not given by the user and
+ * spaces not larger than the recommended ones are not changed. Binary
+ * search keeps the lower end at the value, which gives the standard
+ * cover, so the result is always the tested one.
+ *
+ * \param[in] sizer - generator with the index of the catalog
+ * \param[in] dimensions - input data from the user
+ * \param[out] relaxation - suggested changes and the result of the generator after them
+ * \return True if the standard cover can be generated (with or without changes)
+ */
+bool RelaxationSearch::findNearestFeasible(const CoverSizer & sizer, const SizingInput & dimensions, RelaxationResult & relaxation)
+{
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+
+    relaxation = RelaxationResult();
+
+    SizingInput resolved = dimensions;
+    index.resolveDefaults(resolved);
+
+    ++relaxation.evaluations;
+
+    if(sizer.generateCover(resolved, relaxation.result))
+        return true;
+    // Wszystkie wartości maksymalnie poluzowane
+    SizingInput relaxed = resolved;
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        relaxed.spaces[s] = (resolved.spaces[s] < index.returnDefaultSpace(s)) ? resolved.spaces[s] : index.returnDefaultSpace(s);
+    for(uint8_t o = 0; o < DimNum; ++o)
+        relaxed.obstacles[o] = (resolved.obstacles[o] == -1 || resolved.obstacles[o] > FarObstacle) ? resolved.obstacles[o] : FarObstacle;
+
+    ++relaxation.evaluations;
+
+    if(!sizer.generateCover(relaxed, relaxation.result))
+        return false;
+
+    SizingResult tested;
+
+    for(SOFT_INPUT soft_input : RestoreOrder)
+    {
+        int & value = softValue(relaxed, soft_input);
+        int feasible = value;
+        int wanted = softValue(resolved, soft_input);
+
+        if(feasible == wanted)
+            continue;
+        // Najpierw wartość użytkownika, potem bisekcja
+        value = wanted;
+        ++relaxation.evaluations;
+
+        if(sizer.generateCover(relaxed, tested))
+            continue;
+
+        while(feasible - wanted > 1 || wanted - feasible > 1)
+        {
+            value = feasible + (wanted - feasible) / 2;
+            ++relaxation.evaluations;
+
+            if(sizer.generateCover(relaxed, tested))
+                feasible = value;
+            else
+                wanted = value;
+        }
+
+        value = feasible;
+    }
+
+    ++relaxation.evaluations;
+    sizer.generateCover(relaxed, relaxation.result);
+
+    for(int i = 0; i < SoftInputsNum; ++i)
+    {
+        SOFT_INPUT soft_input = static_cast<SOFT_INPUT>(i);
+        int from = softValue(resolved, soft_input);
+        int to = softValue(relaxed, soft_input);
+
+        if(from == to)
+            continue;
+
+        InputChange & change = relaxation.changes[relaxation.changes_num++];
+        change.input = soft_input;
+        change.from = from;
+        change.to = to;
+    }
+
+    return relaxation.result.error == GenErrors::COVER_OK;
+}
@@ -0,0 +1,354 @@
+#include "RowLayoutSolver.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <unordered_map>
+
+/*!
+ * \brief State of one task of the search
+ *
+ * Remembered layouts of the rest of the row belong to the task,
+ * so the tasks do not share any mutable state.
+ */
+struct RowLayoutSolver::SearchTask
+{
+    /*! Site of the row */
+    const RowSite & site;
+    /*! Criterion of the ranking */
+    OptimizerGoal goal;
+    /*! Lower bounds of the criterion for the rest of the row (from the given heat pump) */
+    const std::vector<uint64_t> & lower_bounds;
+    /*! Best layouts of the rest of the row (key - first heat pump and overhang on the left) */
+    std::unordered_map<uint32_t, SubLayout> remembered;
+    /*! Number of the generated covers */
+    uint32_t evaluations = 0;
+};
+
+/*!
+ * \brief Initialization of the class RowLayoutSolver
+ *
+ * \param[in] parts - parts library loaded by the caller
+ * \param[in] workers - pool, which runs the search (shared with other users)
+ */
+RowLayoutSolver::RowLayoutSolver(CatalogPtr parts, WorkStealingPool & workers) : sizer(parts), pool(workers)
+{
+
+}
+/*!
+ * \brief Check if the site can be laid out (heat pumps within the wall)
+ *
+ * Row has to contain from one to MaxRowUnits heat pumps, dimensions
+ * and gaps cannot be negative and all heat pumps have to stand within
+ * the wall.
+ *
+ * \param[in] site - site of the row
+ * \return True if correct and false otherwise
+ */
+bool RowLayoutSolver::isValid(const RowSite & site)
+{
+    if(site.units.empty() || site.units.size() > MaxRowUnits || site.back_distance < -1)
+        return false;
+
+    int64_t occupied = 0;
+
+    for(const RowUnit & unit : site.units)
+    {
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            if(unit.device[d] < 0)
+                return false;
+        }
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+        {
+            if(unit.spaces[s] < -1)
+                return false;
+        }
+
+        if(unit.gap < 0)
+            return false;
+
+        occupied += unit.gap + unit.device[DIM_ID::LENGTH];
+    }
+
+    return occupied <= site.wall_length;
+}
+/*!
+ * \brief Return the value of the criterion for the cover
+ *
+ * \param[in] result - result of the generator
+ * \param[in] goal - criterion of the ranking
+ * \return Outer footprint or volume of the cover
+ */
+uint64_t RowLayoutSolver::returnScore(const SizingResult & result, OptimizerGoal goal)
+{
+    uint64_t footprint = static_cast<uint64_t>(result.outer_dim[DIM_ID::LENGTH]) * result.outer_dim[DIM_ID::WIDTH];
+
+    return (goal == MIN_VOLUME) ? footprint * result.outer_dim[DIM_ID::HEIGHT] : footprint;
+}
+/*!
+ * \brief Size the cover of the group of the heat pumps
+ *
+ * Group is one device from the left side of the first heat pump to the
+ * right side of the last one (gaps between them included), as deep and
+ * high as the largest heat pump. Front space and top space are chosen so
+ * that every heat pump keeps its own space, side spaces are the larger
+ * of the ends and the back space the largest one (heat pumps stand in
+ * line against the wall). Obstacles are the ones of the generator: on
+ * the left the previous cover (gap minus its overhang) or the end of
+ * the wall, on the right the next heat pump or the end of the wall and
+ * the wall behind. Covers cannot touch, so the obstacle on the left
+ * closer than 1 mm is the collision.
+ *
+ * \param[in] site - site of the row
+ * \param[in] first - index of the first heat pump of the group
+ * \param[in] last - index of the last heat pump of the group
+ * \param[in] overhang - overhang of the previous cover (0 for the first group)
+ * \param[out] result - results of the generator (error code always set)
+ * \return True if the standard cover has been generated and false otherwise
+ */
+bool RowLayoutSolver::sizeGroup(const RowSite & site, int first, int last, int overhang, SizingResult & result) const
+{
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+    const std::vector<RowUnit> & units = site.units;
+
+    auto resolveSpace = [&](const RowUnit & unit, uint8_t space_idx)
+    {
+        return (unit.spaces[space_idx] == -1) ? index.returnDefaultSpace(space_idx) : unit.spaces[space_idx];
+    };
+
+    SizingInput input;
+    int span = 0;
+    int depth = 0;
+    int height = 0;
+    int back_space = 0;
+
+    for(int u = first; u <= last; ++u)
+    {
+        span += units[u].device[DIM_ID::LENGTH] + ((u > first) ? units[u].gap : 0);
+        depth = std::max(depth, units[u].device[DIM_ID::WIDTH]);
+        height = std::max(height, units[u].device[DIM_ID::HEIGHT]);
+        back_space = std::max(back_space, resolveSpace(units[u], 2));
+    }
+
+    int front_space = 0;
+    int top_space = 0;
+
+    for(int u = first; u <= last; ++u)
+    {
+        front_space = std::max(front_space, units[u].device[DIM_ID::WIDTH] + resolveSpace(units[u], 1) - depth);
+        top_space = std::max(top_space, units[u].device[DIM_ID::HEIGHT] + resolveSpace(units[u], 3) - height);
+    }
+
+    input.device[DIM_ID::LENGTH] = span;
+    input.device[DIM_ID::WIDTH] = depth;
+    input.device[DIM_ID::HEIGHT] = height;
+    input.spaces[0] = std::max(resolveSpace(units[first], 0), resolveSpace(units[last], 0));
+    input.spaces[1] = front_space;
+    input.spaces[2] = back_space;
+    input.spaces[3] = top_space;
+
+    // Przeszkody: poprzednia obudowa, następna pompa (lub końce ściany) i ściana z tyłu
+    int right_gap = site.wall_length;
+
+    for(const RowUnit & unit : units)
+        right_gap -= unit.gap + unit.device[DIM_ID::LENGTH];
+
+    input.obstacles[0] = units[first].gap - overhang;
+    input.obstacles[1] = (last + 1 < static_cast<int>(units.size())) ? units[last + 1].gap : right_gap;
+    input.obstacles[2] = site.back_distance;
+
+    // -1 oznacza brak przeszkody, więc nakładające się obudowy są sprawdzane osobno
+    if(input.obstacles[0] <= 0)
+    {
+        result = SizingResult();
+        result.input = input;
+        result.error = GenErrors::LEFT_COLLISION;
+        return false;
+    }
+
+    return sizer.generateCover(input, result);
+}
+/*!
+ * \brief Find the best layout of the rest of the row
+ *
+ * Every group starting with the given heat pump is sized, then the
+ * best layout of the rest after the group is found recursively. Group
+ * is skipped, if its criterion together with the lower bound of the
+ * rest of the row is worse than the best layout found so far. Result
+ * depends only on the first heat pump and the overhang of the previous
+ * cover, so it is remembered and returned again without the search.
+ *
+ * \param[in,out] task - state of the task
+ * \param[in] first - index of the first heat pump of the rest
+ * \param[in] overhang - overhang of the previous cover
+ * \return Best layout of the rest of the row
+ */
+RowLayoutSolver::SubLayout RowLayoutSolver::solveRest(SearchTask & task, int first, int overhang) const
+{
+    int units_num = static_cast<int>(task.site.units.size());
+
+    if(first == units_num)
+    {
+        SubLayout end;
+        end.feasible = true;
+        return end;
+    }
+
+    uint32_t key = (static_cast<uint32_t>(first) << 16) | static_cast<uint32_t>(overhang);
+    auto found = task.remembered.find(key);
+
+    if(found != task.remembered.end())
+        return found->second;
+
+    SubLayout best;
+    SizingResult group;
+    // Obudowa poprzednia sięga do pompy - każda grupa koliduje
+    bool reachable = task.site.units[first].gap - overhang > 0;
+
+    for(int last = first; reachable && last < units_num; ++last)
+    {
+        ++task.evaluations;
+
+        if(!sizeGroup(task.site, first, last, overhang, group))
+            continue;
+
+        uint64_t score = returnScore(group, task.goal);
+
+        if(best.feasible && score + task.lower_bounds[last + 1] > best.score)
+            continue;
+
+        SubLayout rest = solveRest(task, last + 1, returnOverhang(group));
+
+        if(!rest.feasible)
+            continue;
+
+        uint64_t total = score + rest.score;
+        uint8_t covers_num = rest.covers_num + 1;
+
+        if(!best.feasible || total < best.score || (total == best.score && covers_num < best.covers_num))
+        {
+            best.score = total;
+            best.covers_num = covers_num;
+            best.group_end = static_cast<int8_t>(last);
+            best.feasible = true;
+        }
+    }
+
+    task.remembered[key] = best;
+
+    return best;
+}
+/*!
+ * \brief Find the best layout of the standard covers for the row
+ *
+ * Lower bound of the criterion for the heat pumps from the given one to
+ * the end of the row is the sum of their own footprints (or volumes) -
+ * cover is at least as wide as the sum of the widths of its heat pumps
+ * and as deep and high as the largest one. Every choice of the first
+ * group is searched by the separate task, tasks skip the first groups,
+ * which cannot beat the best layout of the other tasks. Best layout of
+ * all tasks is chosen at the end (ties are broken by the number of the
+ * covers and the first group), so it does not depend on the order of
+ * the tasks.
+ *
+ * \param[in] site - site of the row
+ * \param[in] goal - criterion of the ranking
+ * \param[out] layout - best layout (no covers if the standard covers cannot be used)
+ * \return True if the layout has been found and false otherwise
+ */
+bool RowLayoutSolver::solve(const RowSite & site, OptimizerGoal goal, RowLayout & layout) const
+{
+    auto start = std::chrono::steady_clock::now();
+
+    layout = RowLayout();
+
+    if(!isValid(site))
+        return false;
+
+    size_t units_num = site.units.size();
+    std::vector<uint64_t> lower_bounds(units_num + 1, 0);
+
+    for(size_t u = units_num; u-- > 0; )
+    {
+        const int *device = site.units[u].device;
+        uint64_t footprint = static_cast<uint64_t>(device[DIM_ID::LENGTH]) * device[DIM_ID::WIDTH];
+
+        lower_bounds[u] = lower_bounds[u + 1] + ((goal == MIN_VOLUME) ? footprint * device[DIM_ID::HEIGHT] : footprint);
+    }
+
+    std::atomic<uint64_t> best_score(std::numeric_limits<uint64_t>::max());
+    std::vector<RowLayout> partial(units_num);
+
+    pool.parallelFor(units_num, [&](size_t group_end)
+    {
+        SearchTask task = { site, goal, lower_bounds, {}, 0 };
+        RowLayout & candidate = partial[group_end];
+        RowCover first;
+
+        first.units_num = static_cast<uint8_t>(group_end + 1);
+        ++task.evaluations;
+
+        if(sizeGroup(site, 0, static_cast<int>(group_end), 0, first.result))
+        {
+            uint64_t score = returnScore(first.result, goal);
+
+            if(score + lower_bounds[group_end + 1] <= best_score.load())
+            {
+                int overhang = returnOverhang(first.result);
+                SubLayout rest = solveRest(task, static_cast<int>(group_end) + 1, overhang);
+
+                if(rest.feasible)
+                {
+                    candidate.score = score + rest.score;
+                    candidate.covers.push_back(first);
+                    // Odtworzenie układu z zapamiętanych wyników
+                    for(int unit = static_cast<int>(group_end) + 1; unit < static_cast<int>(units_num); )
+                    {
+                        const SubLayout & step = task.remembered[(static_cast<uint32_t>(unit) << 16) | overhang];
+                        RowCover cover;
+
+                        cover.first_unit = static_cast<uint8_t>(unit);
+                        cover.units_num = static_cast<uint8_t>(step.group_end - unit + 1);
+                        sizeGroup(site, unit, step.group_end, overhang, cover.result);
+
+                        overhang = returnOverhang(cover.result);
+                        unit = step.group_end + 1;
+                        candidate.covers.push_back(cover);
+                    }
+
+                    uint64_t current = best_score.load();
+
+                    while(candidate.score < current && !best_score.compare_exchange_weak(current, candidate.score));
+                }
+            }
+        }
+
+        candidate.evaluations = task.evaluations;
+    });
+
+    RowLayout * best = nullptr;
+
+    for(RowLayout & candidate : partial)
+    {
+        layout.evaluations += candidate.evaluations;
+
+        if(candidate.covers.empty())
+            continue;
+
+        if(!best || candidate.score < best->score ||
+           (candidate.score == best->score && candidate.covers.size() < best->covers.size()))
+            best = &candidate;
+    }
+
+    if(best)
+    {
+        layout.covers = std::move(best->covers);
+        layout.score = best->score;
+    }
+
+    layout.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    return best != nullptr;
+}
@@ -0,0 +1,139 @@
+#include "SizingGraph.hpp"
+
+/*!
+ * \brief Bit of the input value or node in the mask
+ */
+static constexpr uint16_t bit(int idx)
+{
+    return static_cast<uint16_t>(1 << idx);
+}
+
+/*!
+ * \brief Input values read directly by each node (bit masks)
+ *
+ * Inputs 0-2: device, 3-5: obstacles, 6-9: spaces.
+ */
+static constexpr uint16_t InputDeps[SizingNodesNum] =
+{
+    bit(0) | bit(6),                            // INNER_LENGTH
+    bit(1) | bit(7) | bit(8),                   // INNER_WIDTH
+    bit(2) | bit(9),                            // INNER_HEIGHT
+    0,                                          // PART_LENGTH
+    0,                                          // PART_WIDTH
+    0,                                          // PART_HEIGHT
+    0,                                          // OUTER_LENGTH
+    0,                                          // OUTER_WIDTH
+    0,                                          // OUTER_HEIGHT
+    bit(0) | bit(3),                            // LEFT_CHECK
+    bit(0) | bit(4),                            // RIGHT_CHECK
+    bit(1) | bit(5) | bit(8)                    // BACK_CHECK
+};
+/*!
+ * \brief Previous nodes read by each node (bit masks)
+ */
+static constexpr uint16_t NodeDeps[SizingNodesNum] =
+{
+    0,                                          // INNER_LENGTH
+    0,                                          // INNER_WIDTH
+    0,                                          // INNER_HEIGHT
+    bit(INNER_LENGTH),                          // PART_LENGTH
+    bit(INNER_WIDTH),                           // PART_WIDTH
+    bit(INNER_HEIGHT),                          // PART_HEIGHT
+    bit(PART_LENGTH),                           // OUTER_LENGTH
+    bit(PART_WIDTH),                            // OUTER_WIDTH
+    bit(PART_HEIGHT),                           // OUTER_HEIGHT
+    bit(OUTER_LENGTH),                          // LEFT_CHECK
+    bit(OUTER_LENGTH),                          // RIGHT_CHECK
+    bit(PART_WIDTH) | bit(OUTER_WIDTH)          // BACK_CHECK
+};
+/*!
+ * \brief Nodes depending (directly or not) on each input value
+ */
+struct InputClosures
+{
+    uint16_t nodes[SizingInputsNum] = {};
+
+    /*!
+     * \brief Visit the nodes in the topological order for each input value
+     */
+    constexpr InputClosures()
+    {
+        for(uint8_t input = 0; input < SizingInputsNum; ++input)
+        {
+            for(uint8_t node = 0; node < SizingNodesNum; ++node)
+            {
+                if((InputDeps[node] & bit(input)) || (NodeDeps[node] & nodes[input]))
+                    nodes[input] |= bit(node);
+            }
+        }
+    }
+};
+/*!
+ * \brief Nodes depending on each input value (computed by the compiler)
+ */
+static constexpr InputClosures Closures;
+
+// Zmiana lewej przeszkody powtarza wyłącznie sprawdzenie lewej kolizji
+static_assert(Closures.nodes[DimNum] == bit(LEFT_CHECK), "Unexpected dependencies of the left obstacle");
+/*!
+ * \brief Return the input value with the given index
+ *
+ * \param[in] input - input data of the generator
+ * \param[in] input_idx - index of the value (0-2: device, 3-5: obstacles, 6-9: spaces)
+ * \return Value of the input
+ */
+int SizingGraph::returnInput(const SizingInput & input, uint8_t input_idx)
+{
+    if(input_idx < DimNum)
+        return input.device[input_idx];
+    if(input_idx < 2 * DimNum)
+        return input.obstacles[input_idx - DimNum];
+
+    return input.spaces[input_idx - 2 * DimNum];
+}
+/*!
+ * \brief Find the input values changed between two requests
+ *
+ * Both inputs should have the default spaces resolved, so the
+ * default value typed by the user is not treated as a change.
+ *
+ * \param[in] previous - input data of the previous request
+ * \param[in] current - input data of the current request
+ * \return Bit mask of the changed input values
+ */
+uint16_t SizingGraph::changedInputs(const SizingInput & previous, const SizingInput & current)
+{
+    uint16_t changed = 0;
+    // Bez rozgałęzień - porównanie wszystkich wartości
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        changed |= (previous.device[i] != current.device[i]) << i;
+        changed |= (previous.obstacles[i] != current.obstacles[i]) << (DimNum + i);
+    }
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        changed |= (previous.spaces[i] != current.spaces[i]) << (2 * DimNum + i);
+
+    return changed;
+}
+/*!
+ * \brief Find the nodes, which have to be computed again
+ *
+ * Dirty nodes are the sum of the nodes depending on each
+ * changed input value (found at compile time).
+ *
+ * \param[in] changed_inputs - bit mask of the changed input values
+ * \return Bit mask of the dirty nodes
+ */
+uint16_t SizingGraph::dirtyNodes(uint16_t changed_inputs)
+{
+    uint16_t dirty = 0;
+
+    while(changed_inputs)
+    {
+        dirty |= Closures.nodes[__builtin_ctz(changed_inputs)];
+        changed_inputs &= changed_inputs - 1;
+    }
+
+    return dirty;
+}
@@ -0,0 +1,371 @@
+#include "SizingKernel.hpp"
+#include <algorithm>
+
+/*!
+ * \brief Initialization of the class SizingKernel with the given parts library
+ *
+ * Copy the index of the catalog and pick the widest instruction
+ * set supported by the current CPU.
+ *
+ * \param[in] parts - parts library loaded by the caller
+ */
+SizingKernel::SizingKernel(const CoverCatalog & parts) : index(parts.returnIndex())
+{
+    isa = detectIsa();
+}
+/*!
+ * \brief Find the widest instruction set supported by the current CPU
+ *
+ * WASM build uses SIMD128 if it has been enabled at compile time
+ * (-msimd128). On x86 the CPU is queried at runtime, so one binary
+ * runs on every machine.
+ *
+ * \return Instruction set (enumeration)
+ */
+KernelIsa SizingKernel::detectIsa()
+{
+#if defined(__wasm_simd128__)
+    return ISA_WASM128;
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx2"))
+        return ISA_AVX2;
+    if(__builtin_cpu_supports("sse4.2"))
+        return ISA_SSE42;
+
+    return ISA_SCALAR;
+#else
+    return ISA_SCALAR;
+#endif
+}
+/*!
+ * \brief Return the name of the instruction set
+ *
+ * \param[in] kernel_isa - instruction set (enumeration)
+ * \return Constant string with the name
+ */
+const char * SizingKernel::isaName(KernelIsa kernel_isa)
+{
+    switch(kernel_isa)
+    {
+        case ISA_SSE42:
+            return "sse4.2";
+        case ISA_AVX2:
+            return "avx2";
+        case ISA_WASM128:
+            return "wasm-simd128";
+        default:
+            return "scalar";
+    }
+}
+/*!
+ * \brief Force the instruction set (if supported)
+ *
+ * Used mainly by the benchmarks and the verification of the
+ * kernels. Instruction set is changed only if the current CPU
+ * supports it.
+ *
+ * \param[in] kernel_isa - instruction set (enumeration)
+ * \return True if changed and false if not supported
+ */
+bool SizingKernel::setIsa(KernelIsa kernel_isa)
+{
+    KernelIsa detected = detectIsa();
+    bool supported = (kernel_isa == ISA_SCALAR) || (kernel_isa == detected) ||
+                     (kernel_isa == ISA_SSE42 && detected == ISA_AVX2);
+
+    if(supported)
+        isa = kernel_isa;
+
+    return supported;
+}
+/*!
+ * \brief Size the covers for all items of the batch
+ *
+ * Pass the batch to the vectorized kernel of the selected
+ * instruction set. It returns the number of sized items (full
+ * vectors only), the rest is sized by the scalar code. If the
+ * array of shifts is given, the collisions on the sides are
+ * searched again with the off-center placement. If the array
+ * of orientations is given, the rotated devices are sized too.
+ *
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of the standard covers generated in the batch
+ */
+size_t SizingKernel::sizeBatch(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const
+{
+    sizeOrientation(inputs, outputs, count);
+
+    if(outputs.rotated != nullptr)
+        sizeRotated(inputs, outputs, count);
+
+    size_t generated_num = 0;
+
+    for(size_t i = 0; i < count; ++i)
+        generated_num += (outputs.errors[i] == GenErrors::COVER_OK);
+
+    return generated_num;
+}
+/*!
+ * \brief Size the covers of the items in the typed orientation
+ *
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ */
+void SizingKernel::sizeOrientation(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const
+{
+    size_t sized = 0;
+
+    switch(isa)
+    {
+        case ISA_SSE42:
+            sized = sizeBatchSse42(index, inputs, outputs, count);
+            break;
+        case ISA_AVX2:
+            sized = sizeBatchAvx2(index, inputs, outputs, count);
+            break;
+        case ISA_WASM128:
+            sized = sizeBatchWasm128(index, inputs, outputs, count);
+            break;
+        default:
+            break;
+    }
+
+    sizeBatchScalar(index, inputs, outputs, sized, count);
+
+    if(outputs.shift != nullptr)
+        placeBatchScalar(index, inputs, outputs, 0, count);
+}
+/*!
+ * \brief Size the rotated devices and keep the better orientation of every item
+ *
+ * Rotated batch is the same batch with the arrays of the width and
+ * depth of the devices swapped (nothing is copied), so it uses the
+ * same vector lanes as the typed one. It is sized in chunks into the
+ * buffers on the stack. Result of the rotated device is copied over
+ * the typed one, if it is better (isRotationBetter).
+ *
+ * \param[in] inputs - flat arrays with the input data
+ * \param[in,out] outputs - results of the typed orientation (replaced by the better ones)
+ * \param[in] count - number of items in the batch
+ */
+void SizingKernel::sizeRotated(const BatchInputs & inputs, BatchOutputs & outputs, size_t count) const
+{
+    uint16_t inner_dim[DimNum][RotationChunk];
+    uint16_t outer_dim[DimNum][RotationChunk];
+    uint8_t modules[RotationChunk];
+    uint8_t errors[RotationChunk];
+    int16_t shift[RotationChunk];
+
+    BatchOutputs chunk_outputs;
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        chunk_outputs.inner_dim[d] = inner_dim[d];
+        chunk_outputs.outer_dim[d] = outer_dim[d];
+    }
+
+    chunk_outputs.modules = modules;
+    chunk_outputs.errors = errors;
+    chunk_outputs.shift = (outputs.shift != nullptr) ? shift : nullptr;
+
+    for(size_t begin = 0; begin < count; begin += RotationChunk)
+    {
+        size_t chunk = std::min(RotationChunk, count - begin);
+        // Zamiana szerokości i głębokości urządzenia
+        BatchInputs chunk_inputs;
+        chunk_inputs.device[0] = inputs.device[1] + begin;
+        chunk_inputs.device[1] = inputs.device[0] + begin;
+        chunk_inputs.device[2] = inputs.device[2] + begin;
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+            chunk_inputs.obstacles[d] = inputs.obstacles[d] + begin;
+        for(uint8_t s = 0; s < DevSides; ++s)
+            chunk_inputs.spaces[s] = inputs.spaces[s] + begin;
+
+        sizeOrientation(chunk_inputs, chunk_outputs, chunk);
+
+        for(size_t i = 0; i < chunk; ++i)
+        {
+            size_t item = begin + i;
+            uint32_t typed_footprint = static_cast<uint32_t>(outputs.outer_dim[0][item]) * outputs.outer_dim[1][item];
+            uint32_t rotated_footprint = static_cast<uint32_t>(outer_dim[0][i]) * outer_dim[1][i];
+
+            outputs.rotated[item] = inputs.device[0][item] != inputs.device[1][item] &&
+                                    isRotationBetter(static_cast<GenErrors>(outputs.errors[item]), typed_footprint,
+                                                     static_cast<GenErrors>(errors[i]), rotated_footprint);
+
+            if(!outputs.rotated[item])
+                continue;
+
+            for(uint8_t d = 0; d < DimNum; ++d)
+            {
+                outputs.inner_dim[d][item] = inner_dim[d][i];
+                outputs.outer_dim[d][item] = outer_dim[d][i];
+            }
+
+            outputs.modules[item] = modules[i];
+            outputs.errors[item] = errors[i];
+
+            if(outputs.shift != nullptr)
+                outputs.shift[item] = shift[i];
+        }
+    }
+}
+/*!
+ * \brief Size the items [begin, end) of the batch one by one
+ *
+ * Scalar version of the kernel. It resolves the default spaces,
+ * checks the limits, looks up the parts in the index and checks
+ * the collisions in the same order as CoverSizer, so the same error
+ * is reported for every item.
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] begin - index of the first item
+ * \param[in] end - index after the last item
+ */
+void sizeBatchScalar(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t begin, size_t end)
+{
+    for(size_t i = begin; i < end; ++i)
+    {
+        int spaces[DevSides];
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+        {
+            int space = inputs.spaces[s][i];
+            spaces[s] = (space == -1) ? index.returnDefaultSpace(s) : space;
+        }
+
+        uint16_t approx_length = inputs.device[0][i] + 2 * spaces[0];
+        uint16_t approx_width = inputs.device[1][i] + spaces[1] + spaces[2];
+        uint16_t approx_height = inputs.device[2][i] + spaces[3];
+
+        GenErrors error = GenErrors::COVER_OK;
+        int length_idx = index.findPart(DIM_ID::LENGTH, approx_length);
+        int width_idx = index.findPart(DIM_ID::WIDTH, approx_width);
+        int height_idx = index.findStack(approx_height);
+
+        if(approx_length > index.returnMaxDim(DIM_ID::LENGTH))
+            error = GenErrors::TOO_LONG;
+        else if(approx_width > index.returnMaxDim(DIM_ID::WIDTH))
+            error = GenErrors::TOO_WIDE;
+        else if(approx_height > index.returnMaxDim(DIM_ID::HEIGHT))
+            error = GenErrors::TOO_HIGH;
+        // Kolejność jak w CoverSizer::searchPartsLibrary (długość, szerokość, wysokość)
+        else if(length_idx == -1)
+            error = GenErrors::NO_PART_LENGTH;
+        else if(width_idx == -1)
+            error = GenErrors::NO_PART_WIDTH;
+        else if(height_idx == -1)
+            error = GenErrors::TOO_HIGH;
+        else
+        {
+            int outer_length = index.returnOuterDims(DIM_ID::LENGTH)[length_idx];
+            int outer_width = index.returnOuterDims(DIM_ID::WIDTH)[width_idx];
+            int inner_width = index.returnInnerDims(DIM_ID::WIDTH)[width_idx];
+            int device_length = inputs.device[0][i];
+            int device_width = inputs.device[1][i];
+
+            int left = inputs.obstacles[0][i];
+            int right = inputs.obstacles[1][i];
+            int back = inputs.obstacles[2][i];
+
+            int offset = inner_width / 2 - device_width / 2 - spaces[2];
+
+            if(left != -1 && device_length / 2 + left <= outer_length / 2)
+                error = GenErrors::LEFT_COLLISION;
+            else if(right != -1 && device_length / 2 + right <= outer_length / 2)
+                error = GenErrors::RIGHT_COLLISION;
+            else if(back != -1 && device_width / 2 + back <= outer_width / 2 - offset)
+                error = GenErrors::BACK_COLLISION;
+        }
+
+        bool generated = (error == GenErrors::COVER_OK);
+
+        outputs.inner_dim[0][i] = generated ? index.returnInnerDims(DIM_ID::LENGTH)[length_idx] : 0;
+        outputs.inner_dim[1][i] = generated ? index.returnInnerDims(DIM_ID::WIDTH)[width_idx] : 0;
+        outputs.inner_dim[2][i] = generated ? index.returnInnerHeights()[height_idx] : 0;
+        outputs.outer_dim[0][i] = generated ? index.returnOuterDims(DIM_ID::LENGTH)[length_idx] : 0;
+        outputs.outer_dim[1][i] = generated ? index.returnOuterDims(DIM_ID::WIDTH)[width_idx] : 0;
+        outputs.outer_dim[2][i] = generated ? index.returnOuterHeights()[height_idx] : 0;
+        outputs.modules[i] = generated ? 2 * index.returnStackModules()[height_idx] : 0;
+        outputs.errors[i] = static_cast<uint8_t>(error);
+    }
+}
+/*!
+ * \brief Move the devices of the items [begin, end) colliding on the left or right inside the covers
+ *
+ * Kernels do not keep the dimensions of the items with errors, so the
+ * parts of the colliding items are looked up again (they have been
+ * found, because the collisions are checked last). Then the shift is
+ * searched as in CoverSizer::placeOffCenter. Shift of every other item
+ * is 0. Collisions are rare, thus the scalar code is sufficient.
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[in,out] outputs - flat arrays with the results of the kernel
+ * \param[in] begin - index of the first item
+ * \param[in] end - index after the last item
+ */
+void placeBatchScalar(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t begin, size_t end)
+{
+    for(size_t i = begin; i < end; ++i)
+    {
+        outputs.shift[i] = 0;
+
+        if(outputs.errors[i] != GenErrors::LEFT_COLLISION && outputs.errors[i] != GenErrors::RIGHT_COLLISION)
+            continue;
+
+        int spaces[DevSides];
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+        {
+            int space = inputs.spaces[s][i];
+            spaces[s] = (space == -1) ? index.returnDefaultSpace(s) : space;
+        }
+
+        uint16_t approx_length = inputs.device[0][i] + 2 * spaces[0];
+        uint16_t approx_width = inputs.device[1][i] + spaces[1] + spaces[2];
+        uint16_t approx_height = inputs.device[2][i] + spaces[3];
+
+        int length_idx = index.findPart(DIM_ID::LENGTH, approx_length);
+        int width_idx = index.findPart(DIM_ID::WIDTH, approx_width);
+        int height_idx = index.findStack(approx_height);
+
+        int inner_length = index.returnInnerDims(DIM_ID::LENGTH)[length_idx];
+        int outer_length = index.returnOuterDims(DIM_ID::LENGTH)[length_idx];
+        int inner_width = index.returnInnerDims(DIM_ID::WIDTH)[width_idx];
+        int outer_width = index.returnOuterDims(DIM_ID::WIDTH)[width_idx];
+        int device_width = inputs.device[1][i];
+        int back = inputs.obstacles[2][i];
+
+        int shift = 0;
+        GenErrors error = PlacementSearch::placeLength(inputs.device[0][i], inner_length, outer_length, spaces[0],
+                                                       inputs.obstacles[0][i], inputs.obstacles[1][i], shift);
+        // Kolizja z tyłu nie zależy od przesunięcia
+        int offset = inner_width / 2 - device_width / 2 - spaces[2];
+
+        if(error == GenErrors::COVER_OK && back != -1 && device_width / 2 + back <= outer_width / 2 - offset)
+            error = GenErrors::BACK_COLLISION;
+
+        outputs.errors[i] = static_cast<uint8_t>(error);
+
+        if(error != GenErrors::COVER_OK)
+            continue;
+
+        outputs.inner_dim[0][i] = inner_length;
+        outputs.inner_dim[1][i] = inner_width;
+        outputs.inner_dim[2][i] = index.returnInnerHeights()[height_idx];
+        outputs.outer_dim[0][i] = outer_length;
+        outputs.outer_dim[1][i] = outer_width;
+        outputs.outer_dim[2][i] = index.returnOuterHeights()[height_idx];
+        outputs.modules[i] = 2 * index.returnStackModules()[height_idx];
+        outputs.shift[i] = static_cast<int16_t>(shift);
+    }
+}
@@ -0,0 +1,87 @@
+#include "SizingKernel.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+
+#include <immintrin.h>
+// Wszystkie funkcje poniżej są kompilowane z AVX2 (wybór w czasie działania)
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#include "SizingKernelBody.hpp"
+
+namespace
+{
+
+/*!
+ * \brief Vector operations of the AVX2 kernel (8 x int32)
+ */
+struct Avx2Ops
+{
+    typedef __m256i Vec;
+    static constexpr int Lanes = 8;
+
+    static Vec load(const int *src) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)); }
+    static void store16(uint16_t *dst, Vec a)
+    {
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, a), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm256_castsi256_si128(packed));
+    }
+    static void store8(uint8_t *dst, Vec a)
+    {
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, a), 0x08);
+        __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_castsi256_si128(packed));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), bytes);
+    }
+    static Vec set1(int value) { return _mm256_set1_epi32(value); }
+    static Vec add(Vec a, Vec b) { return _mm256_add_epi32(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm256_sub_epi32(a, b); }
+    static Vec cmpgt(Vec a, Vec b) { return _mm256_cmpgt_epi32(a, b); }
+    static Vec cmpeq(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+    static Vec andv(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+    static Vec orv(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+    static Vec andnot(Vec a, Vec b) { return _mm256_andnot_si256(a, b); }
+    static Vec blend(Vec mask, Vec a, Vec b) { return _mm256_blendv_epi8(b, a, mask); }
+    static Vec half(Vec a) { return _mm256_srai_epi32(_mm256_add_epi32(a, _mm256_srli_epi32(a, 31)), 1); }
+    static Vec min(Vec a, Vec b) { return _mm256_min_epi32(a, b); }
+    static Vec gather(const int *table, Vec idx) { return _mm256_i32gather_epi32(table, idx, 4); }
+};
+
+}
+
+/*!
+ * \brief Size the items of the batch 8 at a time with AVX2
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of sized items (multiple of 8)
+ */
+size_t sizeBatchAvx2(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count)
+{
+    return sizeBatchVector<Avx2Ops>(index, inputs, outputs, count);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#else
+
+/*!
+ * \brief Size the items of the batch 8 at a time with AVX2 (not available on this platform)
+ *
+ * \return Always 0 - all items are left for the scalar code
+ */
+size_t sizeBatchAvx2(const CatalogIndex &, const BatchInputs &, BatchOutputs &, size_t)
+{
+    return 0;
+}
+
+#endif
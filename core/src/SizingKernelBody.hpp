@@ -0,0 +1,181 @@
+#ifndef SIZINGKERNELBODY_HPP
+#define SIZINGKERNELBODY_HPP
+
+/*!
+ * \file
+ * \brief Common body of the vectorized sizing kernels
+ *
+ * This file is included only by the source files of the
+ * kernels, after the instruction set of the file has been
+ * enabled. It contains the algorithm written once in terms
+ * of the vector operations provided by the Ops structure
+ * of the given instruction set. Everything is placed in the
+ * anonymous namespace, so the code compiled for one
+ * instruction set is never shared with other files.
+ */
+
+#include "SizingKernel.hpp"
+
+namespace
+{
+
+/*!
+ * \brief Find the first part that fits the required dimension in all lanes
+ *
+ * Required dimensions are clamped to the last element of the
+ * first-fit table and the indices of the smallest fitting parts
+ * are gathered from it. Lanes beyond the table or with -1 in it
+ * have no fitting part and use the part 0 (result is masked later).
+ * The mask of the lanes, for which the part fits, is returned.
+ *
+ * \param[in] first_fit - first-fit table of the dimension
+ * \param[in] required - required inner dimensions (not negative)
+ * \param[out] index_found - indices of the found parts
+ * \return Mask of the lanes with the found part
+ */
+template <class Ops>
+typename Ops::Vec findParts(const std::vector<int> & first_fit, typename Ops::Vec required, typename Ops::Vec & index_found)
+{
+    typedef typename Ops::Vec Vec;
+
+    Vec last = Ops::set1(static_cast<int>(first_fit.size()) - 1);
+    Vec part = Ops::gather(first_fit.data(), Ops::min(required, last));
+    Vec found = Ops::andnot(Ops::cmpgt(required, last), Ops::cmpgt(part, Ops::set1(-1)));
+
+    index_found = Ops::andv(part, found);
+
+    return found;
+}
+/*!
+ * \brief Check if there is a collision with the obstacle in all lanes
+ *
+ * Obstacle collides, if it has been given (not -1) and the distance
+ * to it is lower than or equal to the limit.
+ *
+ * \param[in] constraint - distances to the obstacles typed by the user
+ * \param[in] distance - distances to the obstacles from the center
+ * \param[in] limit - half of the cover dimension (with offset)
+ * \return Mask of the lanes with the collision
+ */
+template <class Ops>
+typename Ops::Vec checkCollision(typename Ops::Vec constraint, typename Ops::Vec distance, typename Ops::Vec limit)
+{
+    typename Ops::Vec given = Ops::andnot(Ops::cmpeq(constraint, Ops::set1(-1)), Ops::set1(-1));
+
+    return Ops::andnot(Ops::cmpgt(distance, limit), given);
+}
+/*!
+ * \brief Size the full vectors of the batch
+ *
+ * Vectorized version of sizeBatchScalar. All conditions are
+ * evaluated for every lane and turned into the masks. Errors are
+ * merged from the least to the most important one, so the same
+ * error as in CoverSizer is left in each lane.
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of sized items (multiple of the vector width)
+ */
+template <class Ops>
+size_t sizeBatchVector(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count)
+{
+    typedef typename Ops::Vec Vec;
+
+    // Puste tabele (niekompletny katalog) - wszystko zostaje dla kodu skalarnego
+    if(index.returnInnerDims(DIM_ID::LENGTH).empty() || index.returnInnerDims(DIM_ID::WIDTH).empty() ||
+       index.returnInnerHeights().empty())
+        return 0;
+
+    const int *inner_lengths = index.returnInnerDims(DIM_ID::LENGTH).data();
+    const int *outer_lengths = index.returnOuterDims(DIM_ID::LENGTH).data();
+    const int *inner_widths = index.returnInnerDims(DIM_ID::WIDTH).data();
+    const int *outer_widths = index.returnOuterDims(DIM_ID::WIDTH).data();
+    const int *inner_heights = index.returnInnerHeights().data();
+    const int *outer_heights = index.returnOuterHeights().data();
+    const int *stack_modules = index.returnStackModules().data();
+
+    const Vec not_given = Ops::set1(-1);
+    const Vec low_16_bits = Ops::set1(0xFFFF);
+    size_t i = 0;
+
+    for(; i + Ops::Lanes <= count; i += Ops::Lanes)
+    {
+        Vec device[DimNum];
+        Vec obstacles[DimNum];
+        Vec spaces[DevSides];
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            device[d] = Ops::load(inputs.device[d] + i);
+            obstacles[d] = Ops::load(inputs.obstacles[d] + i);
+        }
+        // Uzupełnienie domyślnych odstępów
+        for(uint8_t s = 0; s < DevSides; ++s)
+        {
+            Vec space = Ops::load(inputs.spaces[s] + i);
+            spaces[s] = Ops::blend(Ops::cmpeq(space, not_given), Ops::set1(index.returnDefaultSpace(s)), space);
+        }
+        // Wymagane wymiary wewnętrzne (obcięte do 16 bitów jak w CoverSizer)
+        Vec approx_length = Ops::andv(Ops::add(device[0], Ops::add(spaces[0], spaces[0])), low_16_bits);
+        Vec approx_width = Ops::andv(Ops::add(device[1], Ops::add(spaces[1], spaces[2])), low_16_bits);
+        Vec approx_height = Ops::andv(Ops::add(device[2], spaces[3]), low_16_bits);
+
+        Vec too_long = Ops::cmpgt(approx_length, Ops::set1(index.returnMaxDim(DIM_ID::LENGTH)));
+        Vec too_wide = Ops::cmpgt(approx_width, Ops::set1(index.returnMaxDim(DIM_ID::WIDTH)));
+        Vec too_high = Ops::cmpgt(approx_height, Ops::set1(index.returnMaxDim(DIM_ID::HEIGHT)));
+
+        Vec index_length, index_width, index_height;
+
+        Vec length_found = findParts<Ops>(index.returnFirstFit(DIM_ID::LENGTH), approx_length, index_length);
+        Vec width_found = findParts<Ops>(index.returnFirstFit(DIM_ID::WIDTH), approx_width, index_width);
+        Vec height_found = findParts<Ops>(index.returnHeightFit(), approx_height, index_height);
+
+        Vec inner_length = Ops::gather(inner_lengths, index_length);
+        Vec outer_length = Ops::gather(outer_lengths, index_length);
+        Vec inner_width = Ops::gather(inner_widths, index_width);
+        Vec outer_width = Ops::gather(outer_widths, index_width);
+        Vec inner_height = Ops::gather(inner_heights, index_height);
+        Vec outer_height = Ops::gather(outer_heights, index_height);
+        Vec wall_modules = Ops::gather(stack_modules, index_height);
+        // Kolizje z przeszkodami
+        Vec half_length = Ops::half(device[0]);
+        Vec half_cover_length = Ops::half(outer_length);
+        Vec offset = Ops::sub(Ops::sub(Ops::half(inner_width), Ops::half(device[1])), spaces[2]);
+        Vec half_cover_width = Ops::sub(Ops::half(outer_width), offset);
+
+        Vec left_collision = checkCollision<Ops>(obstacles[0], Ops::add(half_length, obstacles[0]), half_cover_length);
+        Vec right_collision = checkCollision<Ops>(obstacles[1], Ops::add(half_length, obstacles[1]), half_cover_length);
+        Vec back_collision = checkCollision<Ops>(obstacles[2], Ops::add(Ops::half(device[1]), obstacles[2]), half_cover_width);
+        // Od najmniej do najbardziej istotnego błędu
+        Vec error = Ops::set1(GenErrors::COVER_OK);
+        error = Ops::blend(back_collision, Ops::set1(GenErrors::BACK_COLLISION), error);
+        error = Ops::blend(right_collision, Ops::set1(GenErrors::RIGHT_COLLISION), error);
+        error = Ops::blend(left_collision, Ops::set1(GenErrors::LEFT_COLLISION), error);
+        error = Ops::blend(height_found, error, Ops::set1(GenErrors::TOO_HIGH));
+        error = Ops::blend(width_found, error, Ops::set1(GenErrors::NO_PART_WIDTH));
+        error = Ops::blend(length_found, error, Ops::set1(GenErrors::NO_PART_LENGTH));
+        error = Ops::blend(too_high, Ops::set1(GenErrors::TOO_HIGH), error);
+        error = Ops::blend(too_wide, Ops::set1(GenErrors::TOO_WIDE), error);
+        error = Ops::blend(too_long, Ops::set1(GenErrors::TOO_LONG), error);
+
+        Vec generated = Ops::cmpeq(error, Ops::set1(GenErrors::COVER_OK));
+
+        // Wyniki mieszczą się w typach wyjściowych, nasycenie przy zawężaniu ich nie zmienia
+        Ops::store16(outputs.inner_dim[0] + i, Ops::andv(inner_length, generated));
+        Ops::store16(outputs.inner_dim[1] + i, Ops::andv(inner_width, generated));
+        Ops::store16(outputs.inner_dim[2] + i, Ops::andv(inner_height, generated));
+        Ops::store16(outputs.outer_dim[0] + i, Ops::andv(outer_length, generated));
+        Ops::store16(outputs.outer_dim[1] + i, Ops::andv(outer_width, generated));
+        Ops::store16(outputs.outer_dim[2] + i, Ops::andv(outer_height, generated));
+        Ops::store8(outputs.modules + i, Ops::andv(Ops::add(wall_modules, wall_modules), generated));
+        Ops::store8(outputs.errors + i, error);
+    }
+
+    return i;
+}
+
+}
+
+#endif // SIZINGKERNELBODY_HPP
@@ -0,0 +1,89 @@
+#include "SizingKernel.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+
+#include <cstring>
+#include <immintrin.h>
+// Wszystkie funkcje poniżej są kompilowane z SSE4.2 (wybór w czasie działania)
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse4.2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+#endif
+
+#include "SizingKernelBody.hpp"
+
+namespace
+{
+
+/*!
+ * \brief Vector operations of the SSE4.2 kernel (4 x int32)
+ */
+struct Sse42Ops
+{
+    typedef __m128i Vec;
+    static constexpr int Lanes = 4;
+
+    static Vec load(const int *src) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src)); }
+    static void store16(uint16_t *dst, Vec a) { _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi32(a, a)); }
+    static void store8(uint8_t *dst, Vec a)
+    {
+        __m128i words = _mm_packus_epi32(a, a);
+        int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+        std::memcpy(dst, &bytes, sizeof(bytes));
+    }
+    static Vec set1(int value) { return _mm_set1_epi32(value); }
+    static Vec add(Vec a, Vec b) { return _mm_add_epi32(a, b); }
+    static Vec sub(Vec a, Vec b) { return _mm_sub_epi32(a, b); }
+    static Vec cmpgt(Vec a, Vec b) { return _mm_cmpgt_epi32(a, b); }
+    static Vec cmpeq(Vec a, Vec b) { return _mm_cmpeq_epi32(a, b); }
+    static Vec andv(Vec a, Vec b) { return _mm_and_si128(a, b); }
+    static Vec orv(Vec a, Vec b) { return _mm_or_si128(a, b); }
+    static Vec andnot(Vec a, Vec b) { return _mm_andnot_si128(a, b); }
+    static Vec blend(Vec mask, Vec a, Vec b) { return _mm_blendv_epi8(b, a, mask); }
+    static Vec half(Vec a) { return _mm_srai_epi32(_mm_add_epi32(a, _mm_srli_epi32(a, 31)), 1); }
+    static Vec min(Vec a, Vec b) { return _mm_min_epi32(a, b); }
+    static Vec gather(const int *table, Vec idx)
+    {
+        // SSE4.2 nie ma instrukcji gather - odczyt element po elemencie
+        return _mm_setr_epi32(table[_mm_extract_epi32(idx, 0)], table[_mm_extract_epi32(idx, 1)],
+                              table[_mm_extract_epi32(idx, 2)], table[_mm_extract_epi32(idx, 3)]);
+    }
+};
+
+}
+
+/*!
+ * \brief Size the items of the batch 4 at a time with SSE4.2
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of sized items (multiple of 4)
+ */
+size_t sizeBatchSse42(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count)
+{
+    return sizeBatchVector<Sse42Ops>(index, inputs, outputs, count);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#else
+
+/*!
+ * \brief Size the items of the batch 4 at a time with SSE4.2 (not available on this platform)
+ *
+ * \return Always 0 - all items are left for the scalar code
+ */
+size_t sizeBatchSse42(const CatalogIndex &, const BatchInputs &, BatchOutputs &, size_t)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#include "SizingKernel.hpp"
+
+#if defined(__wasm_simd128__)
+
+#include <wasm_simd128.h>
+#include "SizingKernelBody.hpp"
+
+namespace
+{
+
+/*!
+ * \brief Vector operations of the WASM SIMD128 kernel (4 x int32)
+ */
+struct Wasm128Ops
+{
+    typedef v128_t Vec;
+    static constexpr int Lanes = 4;
+
+    static Vec load(const int *src) { return wasm_v128_load(src); }
+    static void store16(uint16_t *dst, Vec a) { wasm_v128_store64_lane(dst, wasm_u16x8_narrow_i32x4(a, a), 0); }
+    static void store8(uint8_t *dst, Vec a)
+    {
+        v128_t words = wasm_u16x8_narrow_i32x4(a, a);
+        wasm_v128_store32_lane(dst, wasm_u8x16_narrow_i16x8(words, words), 0);
+    }
+    static Vec set1(int value) { return wasm_i32x4_splat(value); }
+    static Vec add(Vec a, Vec b) { return wasm_i32x4_add(a, b); }
+    static Vec sub(Vec a, Vec b) { return wasm_i32x4_sub(a, b); }
+    static Vec cmpgt(Vec a, Vec b) { return wasm_i32x4_gt(a, b); }
+    static Vec cmpeq(Vec a, Vec b) { return wasm_i32x4_eq(a, b); }
+    static Vec andv(Vec a, Vec b) { return wasm_v128_and(a, b); }
+    static Vec orv(Vec a, Vec b) { return wasm_v128_or(a, b); }
+    static Vec andnot(Vec a, Vec b) { return wasm_v128_andnot(b, a); }
+    static Vec blend(Vec mask, Vec a, Vec b) { return wasm_v128_bitselect(a, b, mask); }
+    static Vec half(Vec a) { return wasm_i32x4_shr(wasm_i32x4_add(a, wasm_u32x4_shr(a, 31)), 1); }
+    static Vec min(Vec a, Vec b) { return wasm_i32x4_min(a, b); }
+    static Vec gather(const int *table, Vec idx)
+    {
+        // SIMD128 nie ma instrukcji gather - odczyt element po elemencie
+        return wasm_i32x4_make(table[wasm_i32x4_extract_lane(idx, 0)], table[wasm_i32x4_extract_lane(idx, 1)],
+                               table[wasm_i32x4_extract_lane(idx, 2)], table[wasm_i32x4_extract_lane(idx, 3)]);
+    }
+};
+
+}
+
+/*!
+ * \brief Size the items of the batch 4 at a time with WASM SIMD128
+ *
+ * Available only if the WASM build has been compiled with -msimd128
+ * (browsers without SIMD support need a separate build).
+ *
+ * \param[in] index - index of the parts library
+ * \param[in] inputs - flat arrays with the input data
+ * \param[out] outputs - flat arrays for the results
+ * \param[in] count - number of items in the batch
+ * \return Number of sized items (multiple of 4)
+ */
+size_t sizeBatchWasm128(const CatalogIndex & index, const BatchInputs & inputs, BatchOutputs & outputs, size_t count)
+{
+    return sizeBatchVector<Wasm128Ops>(index, inputs, outputs, count);
+}
+
+#else
+
+/*!
+ * \brief Size the items of the batch 4 at a time with WASM SIMD128 (not available on this platform)
+ *
+ * \return Always 0 - all items are left for the scalar code
+ */
+size_t sizeBatchWasm128(const CatalogIndex &, const BatchInputs &, BatchOutputs &, size_t)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,54 @@
+#include "SizingMessages.hpp"
+#include <sstream>
+#include <iostream>
+
+/*!
+ * \brief Load the error messages from the contents of the messages file
+ *
+ * Split the text line by line and assign each non-empty line as
+ * an element of the table. The order of the lines has to match the
+ * GenErrors enumeration (the same file is used by the GUI).
+ *
+ * \param[in] contents - whole text of the messages file
+ * \return True if all messages have been loaded and false otherwise
+ */
+bool SizingMessages::readMessages(const std::string & contents)
+{
+    std::stringstream text_str(contents);
+    std::string line;
+
+    gen_error_msgs.clear();
+
+    while(std::getline(text_str, line))
+    {
+        if(!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if(!line.empty() && gen_error_msgs.size() < GenErrorsNum)
+            gen_error_msgs.push_back(line);
+    }
+
+    if(gen_error_msgs.size() != GenErrorsNum)
+    {
+        std::cerr << "\nMessages file does not contain all generator errors.\n";
+        return false;
+    }
+
+    return true;
+}
+/*!
+ * \brief Return the message of the given error
+ *
+ * If the error has no message (COVER_OK or table not loaded),
+ * the empty string is returned.
+ *
+ * \param[in] error - generator error (enumeration)
+ * \return Constant reference to the error message
+ */
+const std::string & SizingMessages::returnMessage(GenErrors error) const
+{
+    if(error < 0 || static_cast<size_t>(error) >= gen_error_msgs.size())
+        return empty_msg;
+
+    return gen_error_msgs[error];
+}
@@ -0,0 +1,432 @@
+#include "SizingService.hpp"
+#include <charconv>
+#include <cstring>
+#include <vector>
+
+/*!
+ * \brief Skip the white characters of JSON
+ *
+ * \param[in,out] position - current character
+ * \param[in] end - character after the last one
+ */
+static void skipSpaces(const char *& position, const char *end)
+{
+    while(position < end && (*position == ' ' || *position == '\t' || *position == '\n' || *position == '\r'))
+        ++position;
+}
+/*!
+ * \brief Skip the expected character (and the white characters before it)
+ *
+ * \param[in,out] position - current character
+ * \param[in] end - character after the last one
+ * \param[in] expected - expected character
+ * \return True if found
+ */
+static bool skipCharacter(const char *& position, const char *end, char expected)
+{
+    skipSpaces(position, end);
+
+    if(position == end || *position != expected)
+        return false;
+
+    ++position;
+    return true;
+}
+/*!
+ * \brief Read the array of integers (null means the data not given)
+ *
+ * \param[in,out] position - current character
+ * \param[in] end - character after the last one
+ * \param[out] values - read values
+ * \param[in] values_num - expected number of values
+ * \return True if the array has exactly the expected number of values
+ */
+static bool parseValues(const char *& position, const char *end, int *values, int values_num)
+{
+    if(!skipCharacter(position, end, '['))
+        return false;
+
+    for(int v = 0; v < values_num; ++v)
+    {
+        if(v > 0 && !skipCharacter(position, end, ','))
+            return false;
+
+        skipSpaces(position, end);
+
+        if(end - position >= 4 && std::memcmp(position, "null", 4) == 0)
+        {
+            values[v] = -1;
+            position += 4;
+            continue;
+        }
+
+        std::from_chars_result parsed = std::from_chars(position, end, values[v]);
+
+        if(parsed.ec != std::errc() || values[v] < -1)
+            return false;
+
+        position = parsed.ptr;
+    }
+
+    return skipCharacter(position, end, ']');
+}
+/*!
+ * \brief Initialization of the class SizingService with the given parts library
+ *
+ * \param[in] parts - parts library shared by all threads
+ */
+SizingService::SizingService(CatalogPtr parts) : sizer(parts),
+                                                 batch(*parts),
+                                                 quote_latency(0, LatencyWindow),
+                                                 batch_latency(0, LatencyWindow)
+{
+
+}
+/*!
+ * \brief Load the error messages from the contents of the messages file
+ *
+ * Without the messages the answers have only the status.
+ *
+ * \param[in] contents - whole text of the messages file (GenErrorMsgs.txt)
+ * \return True if all messages have been loaded and false otherwise
+ */
+bool SizingService::setMessages(const std::string & contents)
+{
+    return messages.readMessages(contents);
+}
+/*!
+ * \brief Read one quote (object with the arrays of the input data)
+ *
+ * Keys can be given in any order, the device is required. Data not
+ * given is set to -1 (default spaces, no obstacles). Values have to
+ * be the same as the ones accepted by the GUI (below MaxDimension).
+ *
+ * \param[in,out] position - current character
+ * \param[in] end - character after the last one
+ * \param[out] input - input data of the generator
+ * \return True if the quote is correct
+ */
+bool SizingService::parseQuote(const char *& position, const char *end, SizingInput & input)
+{
+    static constexpr char const *Keys[] = { "\"device\"", "\"obstacles\"", "\"spaces\"" };
+
+    int *arrays[] = { input.device, input.obstacles, input.spaces };
+    const int sizes[] = { DimNum, DimNum, DevSides };
+    bool device_given = false;
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        input.obstacles[i] = -1;
+    for(uint8_t i = 0; i < DevSides; ++i)
+        input.spaces[i] = -1;
+
+    if(!skipCharacter(position, end, '{'))
+        return false;
+    // Pusty obiekt
+    if(skipCharacter(position, end, '}'))
+        return false;
+
+    do
+    {
+        skipSpaces(position, end);
+
+        int key = -1;
+
+        for(int k = 0; k < 3 && key == -1; ++k)
+        {
+            size_t key_length = std::strlen(Keys[k]);
+
+            if(static_cast<size_t>(end - position) >= key_length && std::memcmp(position, Keys[k], key_length) == 0)
+            {
+                key = k;
+                position += key_length;
+            }
+        }
+
+        if(key == -1 || !skipCharacter(position, end, ':') || !parseValues(position, end, arrays[key], sizes[key]))
+            return false;
+
+        device_given = device_given || (key == 0);
+    }
+    while(skipCharacter(position, end, ','));
+
+    if(!skipCharacter(position, end, '}') || !device_given)
+        return false;
+
+    for(int key = 0; key < 3; ++key)
+    {
+        for(int v = 0; v < sizes[key]; ++v)
+        {
+            if(arrays[key][v] >= MaxDimension || (key == 0 && arrays[key][v] < 0))
+                return false;
+        }
+    }
+
+    return true;
+}
+/*!
+ * \brief Append the answer for one quote
+ *
+ * Dimensions are given only for the standard cover. Message is
+ * escaped for JSON (quotation marks, backslashes).
+ *
+ * \param[in] error - error of the generator
+ * \param[in] inner - inner dimensions of the cover
+ * \param[in] outer - outer dimensions of the cover
+ * \param[in] modules - total number of the wall modules
+ * \param[out] response - body of the answer
+ */
+void SizingService::formatAnswer(GenErrors error, const uint16_t inner[DimNum], const uint16_t outer[DimNum],
+                                 uint8_t modules, std::string & response) const
+{
+    char number[16];
+    auto appendNumber = [&](int value)
+    {
+        response.append(number, std::to_chars(number, number + sizeof(number), value).ptr);
+    };
+
+    response += "{\"status\":\"";
+    response += BulkSizer::statusName(error);
+    response += '"';
+
+    const std::string & message = messages.returnMessage(error);
+
+    if(!message.empty())
+    {
+        response += ",\"message\":\"";
+
+        for(char character : message)
+        {
+            unsigned char code = static_cast<unsigned char>(character);
+
+            if(character == '"' || character == '\\')
+            {
+                response += '\\';
+                response += character;
+            }
+            else if(character == '\n')
+                response += "\\n";
+            else if(character == '\r')
+                response += "\\r";
+            else if(character == '\t')
+                response += "\\t";
+            // Pozostałe znaki sterujące jako \u00XX
+            else if(code < 0x20)
+            {
+                static constexpr char Hex[] = "0123456789abcdef";
+                response += "\\u00";
+                response += Hex[code >> 4];
+                response += Hex[code & 0x0F];
+            }
+            else
+                response += character;
+        }
+
+        response += '"';
+    }
+
+    if(error == GenErrors::COVER_OK)
+    {
+        response += ",\"inner\":[";
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            appendNumber(inner[d]);
+            response += (d + 1 < DimNum) ? "," : "],\"outer\":[";
+        }
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            appendNumber(outer[d]);
+            response += (d + 1 < DimNum) ? "," : "],\"modules\":";
+        }
+
+        appendNumber(modules);
+    }
+
+    response += '}';
+}
+/*!
+ * \brief Answer the single quote
+ *
+ * \param[in] body - body of the request (one quote)
+ * \param[in] length - length of the body
+ * \param[out] response - body of the answer (JSON)
+ * \return HTTP status (200 - sized, 400 - wrong request)
+ */
+int SizingService::answerQuote(const char *body, size_t length, std::string & response)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    const char *position = body;
+    const char *end = body + length;
+    SizingInput input;
+
+    response.clear();
+
+    bool correct = parseQuote(position, end, input);
+    skipSpaces(position, end);
+
+    if(!correct || position != end)
+    {
+        response = "{\"error\":\"wrong quote\"}";
+        return 400;
+    }
+
+    SizingResult result;
+    sizer.generateCover(input, result);
+    formatAnswer(result.error, result.inner_dim, result.outer_dim, result.modules, response);
+
+    quote_latency.addSince(start);
+
+    return 200;
+}
+/*!
+ * \brief Answer the batch of quotes
+ *
+ * All quotes are read into the flat arrays and sized by BatchSizer
+ * in one call. Answer is the array of the answers in the same order.
+ *
+ * \param[in] body - body of the request (array of quotes)
+ * \param[in] length - length of the body
+ * \param[out] response - body of the answer (JSON)
+ * \return HTTP status (200 - sized, 400 - wrong request, 413 - too many quotes)
+ */
+int SizingService::answerBatch(const char *body, size_t length, std::string & response)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    const char *position = body;
+    const char *end = body + length;
+    std::vector<SizingInput> quotes;
+
+    response.clear();
+
+    bool correct = skipCharacter(position, end, '[');
+
+    if(correct && !skipCharacter(position, end, ']'))
+    {
+        do
+        {
+            quotes.emplace_back();
+            correct = quotes.size() <= MaxBatchItems && parseQuote(position, end, quotes.back());
+        }
+        while(correct && skipCharacter(position, end, ','));
+
+        correct = correct && skipCharacter(position, end, ']');
+    }
+
+    skipSpaces(position, end);
+
+    if(quotes.size() > MaxBatchItems)
+    {
+        response = "{\"error\":\"too many quotes\"}";
+        return 413;
+    }
+
+    if(!correct || position != end)
+    {
+        response = "{\"error\":\"wrong batch\"}";
+        return 400;
+    }
+    // Płaskie tablice partii
+    size_t count = quotes.size();
+    std::vector<int> inputs[2 * DimNum + DevSides];
+    std::vector<uint16_t> dims[2 * DimNum];
+    std::vector<uint8_t> modules(count);
+    std::vector<uint8_t> errors(count);
+
+    BatchInputs batch_inputs;
+    BatchOutputs batch_outputs;
+
+    for(int c = 0; c < 2 * DimNum + DevSides; ++c)
+        inputs[c].resize(count);
+    for(int c = 0; c < 2 * DimNum; ++c)
+        dims[c].resize(count);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            inputs[d][i] = quotes[i].device[d];
+            inputs[DimNum + d][i] = quotes[i].obstacles[d];
+        }
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+            inputs[2 * DimNum + s][i] = quotes[i].spaces[s];
+    }
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        batch_inputs.device[d] = inputs[d].data();
+        batch_inputs.obstacles[d] = inputs[DimNum + d].data();
+        batch_outputs.inner_dim[d] = dims[d].data();
+        batch_outputs.outer_dim[d] = dims[DimNum + d].data();
+    }
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        batch_inputs.spaces[s] = inputs[2 * DimNum + s].data();
+
+    batch_outputs.modules = modules.data();
+    batch_outputs.errors = errors.data();
+
+    batch.sizeBatch(batch_inputs, batch_outputs, count);
+
+    response.reserve(count * 96);
+    response += '[';
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        uint16_t inner[DimNum];
+        uint16_t outer[DimNum];
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            inner[d] = dims[d][i];
+            outer[d] = dims[DimNum + d][i];
+        }
+
+        if(i > 0)
+            response += ',';
+
+        formatAnswer(static_cast<GenErrors>(errors[i]), inner, outer, modules[i], response);
+    }
+
+    response += ']';
+
+    batch_latency.addSince(start);
+
+    return 200;
+}
+/*!
+ * \brief Append the counters of one endpoint
+ *
+ * \param[in] name - name of the endpoint
+ * \param[in] meter - durations of the requests
+ * \param[out] response - body of the answer
+ */
+void SizingService::formatLatency(const char *name, const LatencyMeter & meter, std::string & response)
+{
+    response += '"';
+    response += name;
+    response += "\":{\"count\":" + std::to_string(meter.returnCount()) +
+                ",\"p50_us\":" + std::to_string(meter.returnPercentile(0.5) / 1000.0) +
+                ",\"p99_us\":" + std::to_string(meter.returnPercentile(0.99) / 1000.0) +
+                ",\"max_us\":" + std::to_string(meter.returnMax() / 1000.0) + "}";
+}
+/*!
+ * \brief Write the latency counters of all endpoints
+ *
+ * Percentiles are calculated from the last requests of each endpoint
+ * (window of the counter), the number of requests and the longest one
+ * cover the whole run.
+ *
+ * \param[out] response - body of the answer (JSON)
+ */
+void SizingService::answerStats(std::string & response) const
+{
+    response = "{";
+    formatLatency("quote", quote_latency, response);
+    response += ',';
+    formatLatency("batch", batch_latency, response);
+    response += '}';
+}
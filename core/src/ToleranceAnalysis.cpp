@@ -0,0 +1,226 @@
+#include "ToleranceAnalysis.hpp"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+/*!
+ * \brief Return the next pseudo-random number (SplitMix64)
+ *
+ * Integer generator with the same sequence on every platform
+ * (unlike the distributions of the standard library).
+ *
+ * \param[in,out] state - state of the generator
+ * \return Pseudo-random number
+ */
+static uint64_t nextRandom(uint64_t & state)
+{
+    uint64_t value = (state += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+    return value ^ (value >> 31);
+}
+/*!
+ * \brief Initialization of the class ToleranceAnalysis
+ *
+ * \param[in] parts - parts library loaded by the caller
+ * \param[in] workers - pool, which sizes the samples (shared with other users)
+ */
+ToleranceAnalysis::ToleranceAnalysis(CatalogPtr parts, WorkStealingPool & workers) : sizer(parts),
+                                                                                     batch(*parts),
+                                                                                     pool(workers)
+{
+
+}
+/*!
+ * \brief Return the settings with the same error of all measured values
+ *
+ * Dimensions of the device and distances to the obstacles are measured
+ * on the site, inner spaces are chosen by the user, so they are exact.
+ *
+ * \param[in] distribution - distribution of the errors
+ * \param[in] spread - largest error (uniform) or standard deviation (normal) in mm
+ * \return Settings of the analysis
+ */
+ToleranceSettings ToleranceAnalysis::returnMeasurementSettings(ToleranceDistribution distribution, int spread)
+{
+    ToleranceSettings settings;
+
+    for(uint8_t i = 0; i < 2 * DimNum; ++i)
+    {
+        settings.inputs[i].distribution = distribution;
+        settings.inputs[i].spread = spread;
+    }
+
+    return settings;
+}
+/*!
+ * \brief Draw the error of one input value
+ *
+ * Normal error is the sum of twelve uniform numbers (Irwin-Hall),
+ * calculated on integers, so it is the same on every platform and
+ * never exceeds six standard deviations.
+ *
+ * \param[in,out] state - state of the generator
+ * \param[in] tolerance - distribution of the error
+ * \return Error in mm
+ */
+int ToleranceAnalysis::drawError(uint64_t & state, const InputTolerance & tolerance)
+{
+    if(tolerance.spread <= 0)
+        return 0;
+
+    if(tolerance.distribution == TOLERANCE_UNIFORM)
+        return static_cast<int>(nextRandom(state) % (2 * static_cast<uint64_t>(tolerance.spread) + 1)) - tolerance.spread;
+
+    if(tolerance.distribution == TOLERANCE_NORMAL)
+    {
+        int64_t sum = 0;
+        // Dwanaście liczb 16-bitowych z trzech losowań
+        for(int i = 0; i < 3; ++i)
+        {
+            uint64_t value = nextRandom(state);
+
+            for(int part = 0; part < 4; ++part)
+                sum += (value >> (16 * part)) & 0xFFFF;
+        }
+        // Odchylenie standardowe sumy to 65536 (z dokładnością do 1/65536)
+        int64_t scaled = (2 * sum - 12 * 0xFFFF) * tolerance.spread;
+
+        return static_cast<int>((scaled >= 0) ? (scaled + 65536) / 131072 : (scaled - 65536) / 131072);
+    }
+
+    return 0;
+}
+/*!
+ * \brief Estimate the probability of each result for the inaccurate input data
+ *
+ * Samples are split into the blocks of the fixed size, each block is
+ * drawn, sized and counted by the separate task of the pool and the
+ * counters of the blocks are added at the end. Probabilities are the
+ * counters divided by the number of the samples (returnShare).
+ *
+ * \param[in] dimensions - input data typed by the user
+ * \param[in] settings - errors of the input values and number of the samples
+ * \param[out] result - result for the typed data and the counters of the samples
+ */
+void ToleranceAnalysis::analyze(const SizingInput & dimensions, const ToleranceSettings & settings,
+                                ToleranceResult & result) const
+{
+    auto start = std::chrono::steady_clock::now();
+
+    result = ToleranceResult();
+    result.samples = settings.samples;
+    sizer.generateCover(dimensions, result.nominal);
+
+    size_t blocks_num = (settings.samples + BlockSamples - 1) / BlockSamples;
+    std::vector<ToleranceResult> partial(blocks_num);
+
+    pool.parallelFor(blocks_num, [&](size_t block)
+    {
+        sizeBlock(dimensions, result.nominal, settings, static_cast<uint32_t>(block), partial[block]);
+    });
+
+    for(const ToleranceResult & counts : partial)
+    {
+        for(uint8_t e = 0; e <= GenErrors::COVER_OK; ++e)
+            result.errors[e] += counts.errors[e];
+        for(uint8_t s = 0; s < CoverSizesNum; ++s)
+            result.sizes[s] += counts.sizes[s];
+
+        result.nominal_count += counts.nominal_count;
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+/*!
+ * \brief Draw, size and count one block of the samples
+ *
+ * Generator of the block is seeded with the seed of the analysis and
+ * the number of the block. Values of every sample are drawn in the
+ * order of SizingInput.
+ *
+ * \param[in] dimensions - input data typed by the user
+ * \param[in] nominal - result of the generator for the typed data
+ * \param[in] settings - errors of the input values and number of the samples
+ * \param[in] block - number of the block
+ * \param[out] counts - counters of the block
+ */
+void ToleranceAnalysis::sizeBlock(const SizingInput & dimensions, const SizingResult & nominal,
+                                  const ToleranceSettings & settings, uint32_t block, ToleranceResult & counts) const
+{
+    size_t first = static_cast<size_t>(block) * BlockSamples;
+    size_t count = std::min<size_t>(BlockSamples, settings.samples - first);
+
+    const int *typed[SizingInputsNum];
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        typed[d] = &dimensions.device[d];
+        typed[DimNum + d] = &dimensions.obstacles[d];
+    }
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        typed[2 * DimNum + s] = &dimensions.spaces[s];
+
+    std::vector<int> inputs[SizingInputsNum];
+    std::vector<uint16_t> dims[2 * DimNum];
+    std::vector<uint8_t> modules(count);
+    std::vector<uint8_t> errors(count);
+
+    for(uint8_t i = 0; i < SizingInputsNum; ++i)
+        inputs[i].resize(count);
+    for(uint8_t i = 0; i < 2 * DimNum; ++i)
+        dims[i].resize(count);
+
+    uint64_t state = settings.seed ^ ((block + 1) * 0xD1B54A32D192ED03ULL);
+
+    for(size_t n = 0; n < count; ++n)
+    {
+        for(uint8_t i = 0; i < SizingInputsNum; ++i)
+        {
+            int error = drawError(state, settings.inputs[i]);
+            // Brak danych pozostaje bez zmian
+            inputs[i][n] = (*typed[i] == -1) ? -1 : std::max(*typed[i] + error, 0);
+        }
+    }
+
+    BatchInputs batch_inputs;
+    BatchOutputs batch_outputs;
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        batch_inputs.device[d] = inputs[d].data();
+        batch_inputs.obstacles[d] = inputs[DimNum + d].data();
+        batch_outputs.inner_dim[d] = dims[d].data();
+        batch_outputs.outer_dim[d] = dims[DimNum + d].data();
+    }
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        batch_inputs.spaces[s] = inputs[2 * DimNum + s].data();
+
+    batch_outputs.modules = modules.data();
+    batch_outputs.errors = errors.data();
+
+    batch.sizeBatch(batch_inputs, batch_outputs, count);
+
+    const CatalogIndex & index = sizer.returnCatalog().returnIndex();
+    bool nominal_ok = nominal.error == GenErrors::COVER_OK;
+    COVER_SIZE nominal_size = index.findCoverSize(nominal.inner_dim[DIM_ID::HEIGHT]);
+
+    for(size_t n = 0; n < count; ++n)
+    {
+        ++counts.errors[errors[n]];
+
+        if(errors[n] == GenErrors::COVER_OK)
+        {
+            COVER_SIZE size = index.findCoverSize(dims[DIM_ID::HEIGHT][n]);
+            ++counts.sizes[size];
+
+            if(nominal_ok && size == nominal_size)
+                ++counts.nominal_count;
+        }
+        else if(errors[n] == nominal.error)
+            ++counts.nominal_count;
+    }
+}
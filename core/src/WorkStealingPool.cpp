@@ -0,0 +1,185 @@
+#include "WorkStealingPool.hpp"
+#include <algorithm>
+
+/*!
+ * \brief Initialization of the class WorkStealingPool
+ *
+ * Create one queue and start one worker for every thread.
+ * If the number is not given, all hardware threads are used.
+ *
+ * \param[in] threads_num - number of the worker threads (0 - automatic)
+ */
+WorkStealingPool::WorkStealingPool(unsigned threads_num) : pending(0), next_queue(0)
+{
+    if(threads_num == 0)
+        threads_num = std::thread::hardware_concurrency();
+    if(threads_num == 0)
+        threads_num = 1;
+
+    for(unsigned i = 0; i < threads_num; ++i)
+        queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+
+    for(unsigned i = 0; i < threads_num; ++i)
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+/*!
+ * \brief Stop and join all workers
+ *
+ * Tasks, which are still waiting in the queues, are dropped.
+ */
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(wake_lock);
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for(std::thread & worker : workers)
+        worker.join();
+}
+/*!
+ * \brief Add the task to the pool
+ *
+ * Tasks are placed in the queues of the workers in turns.
+ *
+ * \param[in] task - function to run
+ */
+void WorkStealingPool::submit(std::function<void()> task)
+{
+    WorkerQueue & queue = *queues[next_queue.fetch_add(1) % queues.size()];
+
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> guard(wake_lock);
+        pending.fetch_add(1);
+    }
+
+    wake.notify_one();
+}
+/*!
+ * \brief Take the task from the given queue or steal it from the others
+ *
+ * The newest task is taken from the own queue (it is probably still
+ * in the cache) and the oldest one is stolen from the other queues.
+ *
+ * \param[in] queue_idx - index of the own queue
+ * \param[out] task - taken task
+ * \return True if the task has been taken and false if all queues are empty
+ */
+bool WorkStealingPool::takeTask(size_t queue_idx, std::function<void()> & task)
+{
+    for(size_t i = 0; i < queues.size(); ++i)
+    {
+        WorkerQueue & queue = *queues[(queue_idx + i) % queues.size()];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        if(queue.tasks.empty())
+            continue;
+        // Własna kolejka od końca, cudze od początku
+        if(i == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+
+        pending.fetch_sub(1);
+        return true;
+    }
+
+    return false;
+}
+/*!
+ * \brief Main loop of the worker
+ *
+ * Run the tasks as long as they are available. Then sleep until
+ * the new task is added or the pool is destroyed.
+ *
+ * \param[in] queue_idx - index of the own queue
+ */
+void WorkStealingPool::workerLoop(size_t queue_idx)
+{
+    std::function<void()> task;
+
+    while(true)
+    {
+        if(takeTask(queue_idx, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(wake_lock);
+        wake.wait(guard, [this] { return stopping || pending.load() > 0; });
+
+        if(stopping)
+            return;
+    }
+}
+/*!
+ * \brief Run the body for every index [0, count) and wait for the end
+ *
+ * Indices are split into the continuous chunks (about four for every
+ * worker, so the uneven chunks are still balanced by stealing), each
+ * chunk is a separate task. The calling thread runs the waiting tasks
+ * (own or from other callers) and, when there are no more of them,
+ * sleeps until its last chunk is done by the workers, so the method
+ * can be called from many threads at the same time (also from the
+ * tasks of the pool).
+ *
+ * \param[in] count - number of the indices
+ * \param[in] body - function called for every index
+ */
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)> & body)
+{
+    if(count == 0)
+        return;
+
+    size_t chunk = std::max<size_t>(1, count / (ChunksPerWorker * workers.size()));
+    size_t chunks_num = (count + chunk - 1) / chunk;
+    // Stan współdzielony z zadaniami - wywołujący może skończyć przed powiadomieniem
+    std::shared_ptr<ForState> state = std::make_shared<ForState>();
+    state->remaining = chunks_num;
+
+    for(size_t begin = 0; begin < count; begin += chunk)
+    {
+        size_t end = std::min(count, begin + chunk);
+
+        submit([&body, state, begin, end]
+        {
+            for(size_t i = begin; i < end; ++i)
+                body(i);
+
+            if(state->remaining.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> guard(state->lock);
+                state->done.notify_all();
+            }
+        });
+    }
+
+    std::function<void()> task;
+
+    while(state->remaining.load() > 0)
+    {
+        if(takeTask(0, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+        // Pozostałe części są już wykonywane przez inne wątki
+        std::unique_lock<std::mutex> guard(state->lock);
+        state->done.wait(guard, [&state] { return state->remaining.load() == 0; });
+    }
+}
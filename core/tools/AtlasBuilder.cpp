@@ -0,0 +1,176 @@
+/*!
+ * \file
+ * \brief Builder of the feasibility atlas
+ *
+ * Builds the FeasibilityAtlas from the catalog, verifies it
+ * against CoverSizer on the grid of the device dimensions
+ * (with random inner spaces and obstacles) and writes it in
+ * the JSON format for the instant quote on the website.
+ * Returns non-zero exit code if any answer differs.
+ *
+ * Usage: hpsizing_atlas [catalog_path] [resolution] [output_path] [grid_step]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "FeasibilityAtlas.hpp"
+
+/*!
+ * \brief Default path to the parameters of the generator
+ */
+#ifndef HPSIZING_DEFAULT_CATALOG
+#define HPSIZING_DEFAULT_CATALOG "resources/txt/CoverParameters.txt"
+#endif
+
+/*!
+ * \brief Largest dimension accepted by the GUI (DimInput)
+ */
+static constexpr int MaxDimension = 2000;
+/*!
+ * \brief Number of the requests used to compare the throughput
+ */
+static constexpr size_t TimedRequests = 1000000;
+
+/*!
+ * \brief Read the whole file into the string
+ */
+static bool readFile(const char *path, std::string & contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return true;
+}
+/*!
+ * \brief Compare the answers of the atlas and the generator
+ */
+static bool sameResults(const SizingResult & first, const SizingResult & second)
+{
+    bool same = first.error == second.error && first.modules == second.modules;
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        same = same && first.approx_inner_dim[d] == second.approx_inner_dim[d]
+                    && first.inner_dim[d] == second.inner_dim[d]
+                    && first.outer_dim[d] == second.outer_dim[d];
+    }
+
+    for(uint8_t s = 0; s < DevSides; ++s)
+        same = same && first.input.spaces[s] == second.input.spaces[s];
+
+    return same;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *catalog_path = (argc > 1) ? argv[1] : HPSIZING_DEFAULT_CATALOG;
+    int resolution = (argc > 2) ? std::atoi(argv[2]) : 10;
+    const char *output_path = (argc > 3) ? argv[3] : nullptr;
+    int grid_step = (argc > 4) ? std::atoi(argv[4]) : 10;
+
+    std::string contents;
+    CatalogPtr catalog;
+
+    if(readFile(catalog_path, contents))
+        catalog = CoverCatalog::loadShared(contents);
+
+    if(!catalog || resolution <= 0 || grid_step <= 0)
+    {
+        std::cerr << "Unable to load the catalog: " << catalog_path << "\n";
+        return 2;
+    }
+
+    CoverSizer sizer(catalog);
+    FeasibilityAtlas atlas;
+
+    auto start = std::chrono::steady_clock::now();
+    bool built = atlas.build(sizer, resolution);
+    double build_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if(!built)
+    {
+        std::cerr << "Catalog does not accept the empty device, atlas cannot be built.\n";
+        return 2;
+    }
+
+    std::cout << "Atlas built in " << build_time * 1e3 << " ms, ranges: "
+              << atlas.returnRuns(DIM_ID::LENGTH).size() << " / " << atlas.returnRuns(DIM_ID::WIDTH).size()
+              << " / " << atlas.returnRuns(DIM_ID::HEIGHT).size() << ", " << atlas.returnBytes() << " bytes\n";
+
+    // Siatka wymiarów urządzenia z losowymi odstępami i przeszkodami
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> space(0, 299);
+    std::uniform_int_distribution<int> obstacle(0, MaxDimension - 1);
+    std::uniform_int_distribution<int> given(0, 3);
+
+    std::vector<SizingInput> requests;
+    SizingResult expected;
+    SizingResult answered;
+    size_t verified = 0;
+    size_t mismatches = 0;
+    size_t generated = 0;
+
+    for(int length = 0; length < MaxDimension; length += grid_step)
+    {
+        for(int width = 0; width < MaxDimension; width += grid_step)
+        {
+            for(int height = 0; height < MaxDimension; height += grid_step)
+            {
+                SizingInput item = { {length, width, height}, {-1, -1, -1}, {-1, -1, -1, -1} };
+
+                for(uint8_t d = 0; d < DimNum; ++d)
+                    item.obstacles[d] = given(rng) ? obstacle(rng) : -1;
+                for(uint8_t s = 0; s < DevSides; ++s)
+                    item.spaces[s] = given(rng) ? space(rng) : -1;
+
+                generated += sizer.generateCover(item, expected);
+                atlas.lookup(item, answered);
+                mismatches += !sameResults(expected, answered);
+                ++verified;
+
+                if(requests.size() < TimedRequests)
+                    requests.push_back(item);
+            }
+        }
+    }
+
+    start = std::chrono::steady_clock::now();
+    for(const SizingInput & item : requests)
+        sizer.generateCover(item, expected);
+    double sizer_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for(const SizingInput & item : requests)
+        atlas.lookup(item, answered);
+    double atlas_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Verified " << verified << " requests (" << generated << " standard covers), mismatches: "
+              << mismatches << "\n";
+    std::cout << "CoverSizer: " << requests.size() / sizer_time / 1e6 << " M items/s, atlas: "
+              << requests.size() / atlas_time / 1e6 << " M items/s\n";
+
+    if(output_path)
+    {
+        std::ofstream output(output_path);
+        atlas.writeJson(output);
+
+        if(!output)
+        {
+            std::cerr << "Unable to write the atlas: " << output_path << "\n";
+            return 2;
+        }
+    }
+
+    return (mismatches == 0) ? 0 : 1;
+}
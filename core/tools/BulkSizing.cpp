@@ -0,0 +1,120 @@
+/*!
+ * \file
+ * \brief Streaming sizing of the site surveys
+ *
+ * Sizes every row of the site survey exported as the CSV file
+ * (device, obstacles and inner spaces, as in DataWindow) and
+ * writes the results in the input order as CSV or JSONL. File
+ * is streamed in constant memory, so it can be of any size.
+ * Prints the number of rows and the throughput on the error
+ * output. Returns non-zero exit code if the file could not be
+ * read or written.
+ *
+ * Usage: hpsizing_bulk input_path output_path [csv|jsonl] [catalog_path] [threads]
+ * (path "-" means the standard input / output)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BulkSizer.hpp"
+
+/*!
+ * \brief Default path to the parameters of the generator
+ */
+#ifndef HPSIZING_DEFAULT_CATALOG
+#define HPSIZING_DEFAULT_CATALOG "resources/txt/CoverParameters.txt"
+#endif
+
+/*!
+ * \brief Size of the buffers of the input and output files
+ */
+static constexpr size_t StreamBuffer = 1 << 20;
+
+/*!
+ * \brief Read the whole file into the string
+ */
+static bool readFile(const char *path, std::string & contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: hpsizing_bulk input_path output_path [csv|jsonl] [catalog_path] [threads]\n";
+        return 2;
+    }
+
+    BulkFormat format = (argc > 3 && std::strcmp(argv[3], "jsonl") == 0) ? BULK_JSONL : BULK_CSV;
+    const char *catalog_path = (argc > 4) ? argv[4] : HPSIZING_DEFAULT_CATALOG;
+    unsigned threads_num = (argc > 5) ? static_cast<unsigned>(std::atoi(argv[5])) : 0;
+
+    std::string contents;
+    CatalogPtr catalog;
+
+    if(readFile(catalog_path, contents))
+        catalog = CoverCatalog::loadShared(contents);
+
+    if(!catalog)
+    {
+        std::cerr << "Unable to load the catalog: " << catalog_path << "\n";
+        return 2;
+    }
+
+    bool standard_input = std::strcmp(argv[1], "-") == 0;
+    bool standard_output = std::strcmp(argv[2], "-") == 0;
+    std::FILE *input = standard_input ? stdin : std::fopen(argv[1], "rb");
+    std::FILE *output = standard_output ? stdout : std::fopen(argv[2], "wb");
+
+    if(input == nullptr || output == nullptr)
+    {
+        std::cerr << "Unable to open the input or output file.\n";
+        return 2;
+    }
+
+    std::vector<char> input_buffer(StreamBuffer);
+    std::vector<char> output_buffer(StreamBuffer);
+    std::setvbuf(input, input_buffer.data(), _IOFBF, input_buffer.size());
+    std::setvbuf(output, output_buffer.data(), _IOFBF, output_buffer.size());
+
+    WorkStealingPool pool(threads_num);
+    BulkSizer bulk(*catalog, pool);
+    BulkStats stats;
+
+    bool correct = bulk.sizeStream(input, output, format, stats);
+
+    if(!standard_input)
+        std::fclose(input);
+    if(!standard_output)
+        correct = (std::fclose(output) == 0) && correct;
+    else
+        std::fflush(output);
+
+    std::cerr << "Rows: " << stats.rows << ", standard covers: " << stats.generated << ", invalid rows: "
+              << stats.invalid << ", " << stats.seconds << " s, " << stats.rows / stats.seconds / 1e6
+              << " M rows/s (" << pool.returnThreadsNum() << " threads)\n";
+
+    if(!correct)
+    {
+        std::cerr << "Error of reading or writing the files.\n";
+        return 1;
+    }
+
+    return 0;
+}
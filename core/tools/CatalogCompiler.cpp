@@ -0,0 +1,94 @@
+/*!
+ * \file
+ * \brief Compiler of the parts library
+ *
+ * Parses the text file with the parameters of the generator,
+ * writes the compiled (binary) catalog and loads it back to
+ * verify it (checksum and the same catalog compiled again). Run at
+ * every build, so it only validates the catalog - results of both
+ * catalogs and the times of loading are compared by hpsizing_bench.
+ * Optionally writes also the C++ header with the constexpr tables
+ * of the catalog (EmbeddedCatalog).
+ *
+ * Usage: hpsizing_compile catalog_path output_path [header_path]
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "CatalogBlob.hpp"
+
+/*!
+ * \brief Read the whole file into the string
+ */
+static bool readFile(const char *path, std::string & contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: hpsizing_compile catalog_path output_path [header_path]\n";
+        return 2;
+    }
+
+    std::string contents;
+    CatalogPtr text_catalog;
+
+    if(readFile(argv[1], contents))
+        text_catalog = CoverCatalog::loadShared(contents);
+
+    if(!text_catalog)
+    {
+        std::cerr << "Unable to load the catalog: " << argv[1] << "\n";
+        return 2;
+    }
+
+    std::string blob = CatalogBlob::compile(*text_catalog);
+    std::ofstream output(argv[2], std::ios::binary);
+    output.write(blob.data(), blob.size());
+    output.close();
+
+    if(!output)
+    {
+        std::cerr << "Unable to write the compiled catalog: " << argv[2] << "\n";
+        return 2;
+    }
+
+    if(argc > 3)
+    {
+        std::ofstream header(argv[3]);
+        CatalogBlob::writeHeader(*text_catalog, header);
+        header.close();
+
+        if(!header)
+        {
+            std::cerr << "Unable to write the header of the catalog: " << argv[3] << "\n";
+            return 2;
+        }
+    }
+
+    // Suma kontrolna (loadFile) i ten sam katalog po ponownej kompilacji
+    CatalogPtr compiled_catalog = CatalogBlob::loadFile(argv[2]);
+
+    if(!compiled_catalog || CatalogBlob::compile(*compiled_catalog) != blob)
+    {
+        std::cerr << "Compiled catalog differs from the text one: " << argv[2] << "\n";
+        return 1;
+    }
+
+    std::cout << "Compiled " << argv[1] << " -> " << argv[2] << " (" << blob.size() << " bytes)\n";
+
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*!
+ * \file
+ * \brief Load generator of the local HTTP sizing service
+ *
+ * Opens the given number of kept-alive connections to hpsizing_server,
+ * each one in its own thread, and sends the random quotes (or batches
+ * of quotes) one after another for the given time. Prints the number
+ * of requests per second, the p50 / p99 latency seen by the clients
+ * and the counters of the server (GET /stats). Returns non-zero exit
+ * code if any request failed.
+ *
+ * Usage: hpsizing_load [port] [connections] [seconds] [batch_items]
+ * (batch_items 0 - single quotes)
+ */
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "LatencyMeter.hpp"
+#include "SizingTypes.hpp"
+
+/*!
+ * \brief Default port of the service
+ */
+static constexpr int DefaultPort = 8088;
+/*!
+ * \brief Number of the samples in the window of the latency counter
+ */
+static constexpr size_t LatencyWindow = 1 << 20;
+
+/*!
+ * \brief Connection to the service
+ */
+class ServiceClient
+{
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Socket of the connection
+         */
+        int fd = -1;
+        /*!
+         * \brief Received bytes, which do not belong to the read answers
+         */
+        std::string received;
+
+    public:
+        /*!
+         * \brief Connect to the service on the localhost
+         */
+        bool connectTo(int port)
+        {
+            fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+            sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(static_cast<uint16_t>(port));
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+            int no_delay = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+            return fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0;
+        }
+        /*!
+         * \brief Send the request and read the answer (status and body)
+         */
+        bool request(const char *method, const char *path, const std::string & body, int & status, std::string & answer)
+        {
+            std::string request = std::string(method) + " " + path + " HTTP/1.1\r\nHost: 127.0.0.1\r\n"
+                                  "Content-Type: application/json\r\nContent-Length: " +
+                                  std::to_string(body.size()) + "\r\n\r\n" + body;
+
+            for(size_t sent = 0; sent < request.size(); )
+            {
+                ssize_t result = send(fd, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+
+                if(result <= 0)
+                    return false;
+
+                sent += result;
+            }
+
+            char buffer[65536];
+            size_t header_end;
+
+            while((header_end = received.find("\r\n\r\n")) == std::string::npos)
+            {
+                ssize_t result = recv(fd, buffer, sizeof(buffer), 0);
+
+                if(result <= 0)
+                    return false;
+
+                received.append(buffer, result);
+            }
+
+            status = std::atoi(received.c_str() + std::strlen("HTTP/1.1 "));
+
+            size_t length_pos = received.find("Content-Length: ");
+
+            if(length_pos == std::string::npos || length_pos > header_end)
+                return false;
+
+            size_t answer_end = header_end + 4 + std::strtoull(received.c_str() + length_pos + 16, nullptr, 10);
+
+            while(received.size() < answer_end)
+            {
+                ssize_t result = recv(fd, buffer, sizeof(buffer), 0);
+
+                if(result <= 0)
+                    return false;
+
+                received.append(buffer, result);
+            }
+
+            answer.assign(received, header_end + 4, answer_end - header_end - 4);
+            received.erase(0, answer_end);
+
+            return true;
+        }
+        /*!
+         * \brief Close the connection
+         */
+        ~ServiceClient()
+        {
+            if(fd >= 0)
+                close(fd);
+        }
+};
+
+/*!
+ * \brief Append the random quote (typical data of the GUI)
+ */
+static void appendQuote(std::mt19937 & rng, std::string & body)
+{
+    std::uniform_int_distribution<int> device(300, 1999);
+    std::uniform_int_distribution<int> obstacle(0, 1999);
+    std::uniform_int_distribution<int> space(0, 150);
+    std::uniform_int_distribution<int> given(0, 3);
+
+    body += "{\"device\":[" + std::to_string(device(rng)) + "," + std::to_string(device(rng)) + "," +
+            std::to_string(device(rng)) + "],\"obstacles\":[";
+
+    for(uint8_t i = 0; i < DimNum; ++i)
+        body += (given(rng) ? std::to_string(obstacle(rng)) : std::string("null")) + ((i + 1 < DimNum) ? "," : "]");
+
+    body += ",\"spaces\":[";
+
+    for(uint8_t i = 0; i < DevSides; ++i)
+        body += (given(rng) ? std::to_string(space(rng)) : std::string("null")) + ((i + 1 < DevSides) ? "," : "]}");
+}
+
+int main(int argc, char *argv[])
+{
+    int port = (argc > 1) ? std::atoi(argv[1]) : DefaultPort;
+    int connections_num = (argc > 2) ? std::atoi(argv[2]) : 4;
+    double seconds = (argc > 3) ? std::atof(argv[3]) : 5.0;
+    int batch_items = (argc > 4) ? std::atoi(argv[4]) : 0;
+
+    LatencyMeter latency(0, LatencyWindow);
+    std::atomic<uint64_t> failures(0);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    auto stop = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+
+    for(int c = 0; c < connections_num; ++c)
+    {
+        threads.emplace_back([&, c]()
+        {
+            ServiceClient client;
+
+            if(!client.connectTo(port))
+            {
+                ++failures;
+                return;
+            }
+
+            std::mt19937 rng(100 + c);
+            std::string body;
+            std::string answer;
+            int status = 0;
+
+            while(std::chrono::steady_clock::now() < stop)
+            {
+                body.clear();
+
+                if(batch_items > 0)
+                {
+                    body += '[';
+
+                    for(int i = 0; i < batch_items; ++i)
+                    {
+                        body += (i > 0) ? "," : "";
+                        appendQuote(rng, body);
+                    }
+
+                    body += ']';
+                }
+                else
+                    appendQuote(rng, body);
+
+                auto sent = std::chrono::steady_clock::now();
+
+                if(!client.request("POST", (batch_items > 0) ? "/batch" : "/quote", body, status, answer) || status != 200)
+                {
+                    ++failures;
+                    return;
+                }
+
+                latency.addSince(sent);
+            }
+        });
+    }
+
+    for(std::thread & thread : threads)
+        thread.join();
+
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t requests = latency.returnCount();
+    uint64_t items = requests * ((batch_items > 0) ? batch_items : 1);
+
+    std::cout << "Requests: " << requests << " (" << requests / time << " req/s, " << items / time
+              << " quotes/s), connections: " << connections_num << ", failures: " << failures << "\n"
+              << "Client latency: p50 " << latency.returnPercentile(0.5) / 1000.0 << " us, p99 "
+              << latency.returnPercentile(0.99) / 1000.0 << " us, max " << latency.returnMax() / 1000.0 << " us\n";
+
+    ServiceClient client;
+    std::string answer;
+    int status = 0;
+
+    if(client.connectTo(port) && client.request("GET", "/stats", "", status, answer))
+        std::cout << "Server counters: " << answer << "\n";
+
+    return (failures == 0) ? 0 : 1;
+}
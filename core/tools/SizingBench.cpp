@@ -0,0 +1,1259 @@
+/*!
+ * \file
+ * \brief Benchmark and verification of the batch sizing
+ *
+ * Generates random inputs of the generator, sizes them with the
+ * reference CoverSizer (one by one), with the same CoverSizer shared
+ * by all hardware threads and with SizingKernel using every
+ * instruction set supported by the CPU. Also sizes the sequence
+ * of requests differing by one value (like the live preview or
+ * what-if sweep) fully and incrementally. Small CoverCache (with the
+ * replacement of the entries) is compared with CoverSizer on the
+ * repeated requests and with the catalog replaced while sizing.
+ * Off-center placement of the batch is compared with the one of
+ * CoverSizer, the same applies to the rotated devices. K best covers
+ * of CoverOptimizer are compared with all combinations of the parts.
+ * Results of ProductFamilies (few and many families) are compared with
+ * CoverSizer of each family. Failed requests are searched for the
+ * nearest data giving the standard cover (RelaxationSearch). Sizes of
+ * the covers (S, M, L, XL) are checked for every stack of the modules.
+ * Typical requests are analyzed with the inaccurate measurements
+ * (ToleranceAnalysis), results of the pools of different sizes must
+ * be equal. Rows of heat pumps are laid out by RowLayoutSolver and
+ * compared with all possible groupings. Prints throughput of each
+ * variant and compares all results with the reference. Compiled
+ * catalog (CatalogBlob) and the catalog compiled into the program (if
+ * enabled) are compared with the default catalog too, times of loading
+ * the text, compiled and large generated catalog (thousands of parts)
+ * are measured. Returns non-zero exit code if any result differs.
+ *
+ * Usage: hpsizing_bench [catalog_path] [items]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "BatchSizer.hpp"
+#include "CatalogBlob.hpp"
+#include "CoverCache.hpp"
+#include "CoverOptimizer.hpp"
+#include "CoverSizer.hpp"
+#include "EmbeddedCatalog.hpp"
+#include "ProductFamilies.hpp"
+#include "RelaxationSearch.hpp"
+#include "RowLayoutSolver.hpp"
+#include "ToleranceAnalysis.hpp"
+
+/*!
+ * \brief Default path to the parameters of the generator
+ */
+#ifndef HPSIZING_DEFAULT_CATALOG
+#define HPSIZING_DEFAULT_CATALOG "resources/txt/CoverParameters.txt"
+#endif
+
+/*!
+ * \brief Number of the input columns (device, obstacles, spaces)
+ */
+static constexpr int InputColumns = 2 * DimNum + DevSides;
+/*!
+ * \brief Number of the output columns (inner, outer, modules, error)
+ */
+static constexpr int OutputColumns = 2 * DimNum + 2;
+/*!
+ * \brief Number of loads used to measure the time of loading the catalog
+ */
+static constexpr int TimedLoads = 2000;
+/*!
+ * \brief Number of the widths and depths of the generated large catalog
+ */
+static constexpr int LargeCatalogParts = 4000;
+
+/*!
+ * \brief Flat buffers of the batch owned by the benchmark
+ */
+struct BenchBuffers
+{
+    std::vector<int> inputs[InputColumns];
+    std::vector<uint16_t> dims[2 * DimNum];
+    std::vector<uint8_t> modules;
+    std::vector<uint8_t> errors;
+    std::vector<int16_t> shifts;
+    std::vector<uint8_t> rotations;
+
+    BatchInputs in;
+    BatchOutputs out;
+
+    explicit BenchBuffers(size_t count)
+    {
+        for(int c = 0; c < InputColumns; ++c)
+            inputs[c].resize(count);
+        for(int c = 0; c < 2 * DimNum; ++c)
+            dims[c].resize(count);
+
+        modules.resize(count);
+        errors.resize(count);
+        shifts.resize(count);
+        rotations.resize(count);
+
+        for(uint8_t i = 0; i < DimNum; ++i)
+        {
+            in.device[i] = inputs[i].data();
+            in.obstacles[i] = inputs[DimNum + i].data();
+            out.inner_dim[i] = dims[i].data();
+            out.outer_dim[i] = dims[DimNum + i].data();
+        }
+
+        for(uint8_t i = 0; i < DevSides; ++i)
+            in.spaces[i] = inputs[2 * DimNum + i].data();
+
+        out.modules = modules.data();
+        out.errors = errors.data();
+    }
+};
+
+/*!
+ * \brief Read the whole file into the string
+ */
+static bool readFile(const char *path, std::string & contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return true;
+}
+/*!
+ * \brief Fill the inputs with random data (similar to the one accepted by the GUI)
+ */
+static void randomInputs(BenchBuffers & buffers, size_t count)
+{
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> dimension(0, 1999);
+    std::uniform_int_distribution<int> space(0, 299);
+    std::uniform_int_distribution<int> given(0, 3);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            buffers.inputs[d][i] = dimension(rng);
+            buffers.inputs[DimNum + d][i] = given(rng) ? dimension(rng) : -1;
+        }
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+            buffers.inputs[2 * DimNum + s][i] = given(rng) ? space(rng) : -1;
+    }
+}
+/*!
+ * \brief Draw the request from the ranges of the typical data
+ *
+ * Every obstacle and space is not given (-1) with the probability of 1/4.
+ */
+static void randomRequest(std::mt19937 & rng, const int lowest[SizingInputsNum], const int highest[SizingInputsNum],
+                          SizingInput & item)
+{
+    std::uniform_int_distribution<int> given(0, 3);
+
+    for(uint8_t v = 0; v < SizingInputsNum; ++v)
+    {
+        int value = std::uniform_int_distribution<int>(lowest[v], highest[v])(rng);
+
+        if(v >= DimNum && !given(rng))
+            value = -1;
+
+        if(v < DimNum)
+            item.device[v] = value;
+        else if(v < 2 * DimNum)
+            item.obstacles[v - DimNum] = value;
+        else
+            item.spaces[v - 2 * DimNum] = value;
+    }
+}
+/*!
+ * \brief Size the items [begin, end) one by one with CoverSizer (reference results)
+ */
+static void sizeReference(const CoverSizer & sizer, BenchBuffers & buffers, size_t begin, size_t end, bool off_center,
+                          bool rotation)
+{
+    SizingInput item;
+    SizingResult result;
+
+    for(size_t i = begin; i < end; ++i)
+    {
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            item.device[d] = buffers.in.device[d][i];
+            item.obstacles[d] = buffers.in.obstacles[d][i];
+        }
+
+        for(uint8_t s = 0; s < DevSides; ++s)
+            item.spaces[s] = buffers.in.spaces[s][i];
+
+        bool generated = sizer.generateCover(item, result);
+
+        if(off_center)
+        {
+            generated = sizer.placeOffCenter(result);
+            buffers.shifts[i] = result.shift;
+        }
+
+        if(rotation)
+        {
+            generated = sizer.exploreRotation(result, off_center);
+            buffers.shifts[i] = result.shift;
+            buffers.rotations[i] = result.rotated;
+        }
+
+        for(uint8_t d = 0; d < DimNum; ++d)
+        {
+            buffers.out.inner_dim[d][i] = generated ? result.inner_dim[d] : 0;
+            buffers.out.outer_dim[d][i] = generated ? result.outer_dim[d] : 0;
+        }
+
+        buffers.out.modules[i] = generated ? result.modules : 0;
+        buffers.out.errors[i] = result.error;
+    }
+}
+/*!
+ * \brief Size the batch with one CoverSizer shared by the given number of threads
+ */
+static void sizeReferenceParallel(const CoverSizer & sizer, BenchBuffers & buffers, size_t count, unsigned threads_num)
+{
+    std::vector<std::thread> threads;
+    size_t chunk = (count + threads_num - 1) / threads_num;
+
+    for(size_t begin = 0; begin < count; begin += chunk)
+    {
+        size_t end = (begin + chunk < count) ? begin + chunk : count;
+        threads.emplace_back(sizeReference, std::cref(sizer), std::ref(buffers), begin, end, false, false);
+    }
+
+    for(std::thread & thread : threads)
+        thread.join();
+}
+/*!
+ * \brief Compare all values of two results
+ */
+static bool sameResults(const SizingResult & first, const SizingResult & second)
+{
+    bool same = first.error == second.error && first.modules == second.modules;
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        same = same && first.approx_inner_dim[d] == second.approx_inner_dim[d]
+                    && first.inner_dim[d] == second.inner_dim[d]
+                    && first.outer_dim[d] == second.outer_dim[d];
+    }
+
+    for(uint8_t i = 0; i < SizingInputsNum; ++i)
+        same = same && SizingGraph::returnInput(first.input, i) == SizingGraph::returnInput(second.input, i);
+
+    return same;
+}
+/*!
+ * \brief Size the sequence of requests, each one differing from the previous by one value
+ *
+ * Every request is sized fully (generateCover) and incrementally
+ * (updateCover). Prints throughput of both and the average number
+ * of the computed nodes of the dependency graph.
+ *
+ * \return Number of requests with different results
+ */
+static size_t sizeSweep(const CoverSizer & sizer, size_t count)
+{
+    // Zakresy typowych danych (urządzenie, przeszkody, odstępy)
+    const int lowest[SizingInputsNum] = { 800, 400, 500, 300, 300, 300, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 1800, 800, 1100, 1500, 1500, 1500, 100, 100, 100, 100 };
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> changed_value(0, SizingInputsNum - 1);
+    std::uniform_int_distribution<int> given(0, 3);
+
+    std::vector<SizingInput> requests(count);
+    SizingInput item = { {1000, 500, 800}, {-1, -1, -1}, {-1, -1, -1, -1} };
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        uint8_t value = changed_value(rng);
+        int new_value = std::uniform_int_distribution<int>(lowest[value], highest[value])(rng);
+
+        if(value >= DimNum && !given(rng))
+            new_value = -1;
+
+        if(value < DimNum)
+            item.device[value] = new_value;
+        else if(value < 2 * DimNum)
+            item.obstacles[value - DimNum] = new_value;
+        else
+            item.spaces[value - 2 * DimNum] = new_value;
+
+        requests[i] = item;
+    }
+
+    std::vector<SizingResult> full(count);
+    std::vector<SizingResult> incremental(count);
+    SizingState state;
+    uint64_t nodes = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < count; ++i)
+        sizer.generateCover(requests[i], full[i]);
+    double full_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < count; ++i)
+    {
+        sizer.updateCover(requests[i], state, incremental[i]);
+        nodes += __builtin_popcount(state.recomputed);
+    }
+    double incremental_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < count; ++i)
+        mismatches += !sameResults(full[i], incremental[i]);
+
+    std::cout << "Sweep (one value changed): full " << count / full_time / 1e6 << " M items/s, incremental "
+              << count / incremental_time / 1e6 << " M items/s, nodes per request: "
+              << static_cast<double>(nodes) / count << " of " << static_cast<int>(SizingNodesNum)
+              << ", mismatches: " << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Compare the results of the small CoverCache with CoverSizer
+ *
+ * Requests are drawn from the fixed set, the first ones much more often
+ * (like the same devices quoted again), so there are hits and the
+ * entries are replaced by the CLOCK policy. Every result is compared
+ * with the one of the generator, first in one thread, then in all
+ * hardware threads sharing the cache. Prints the hits and misses.
+ *
+ * \return Number of results different from the generator
+ */
+static size_t sizeCached(CatalogPtr catalog, size_t count, unsigned threads_num)
+{
+    const int lowest[SizingInputsNum] = { 600, 300, 400, 200, 200, 200, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 2000, 900, 1400, 1500, 1500, 1500, 150, 150, 150, 150 };
+    const size_t requests_num = 4096;
+    const size_t capacity = 256;
+
+    std::mt19937 rng(23);
+    std::vector<SizingInput> requests(requests_num);
+    std::vector<SizingResult> expected(requests_num);
+    CoverSizer sizer(catalog);
+
+    for(size_t r = 0; r < requests_num; ++r)
+    {
+        randomRequest(rng, lowest, highest, requests[r]);
+        sizer.generateCover(requests[r], expected[r]);
+    }
+
+    CoverCache cache(catalog, capacity);
+    std::atomic<size_t> mismatches(0);
+
+    // Kwadrat liczby losowej - pierwsze zapytania znacznie częściej
+    auto sizeRange = [&](uint32_t seed, size_t items)
+    {
+        std::mt19937 local_rng(seed);
+        std::uniform_real_distribution<double> draw(0.0, 1.0);
+        SizingResult result;
+
+        for(size_t i = 0; i < items; ++i)
+        {
+            double value = draw(local_rng);
+            size_t r = static_cast<size_t>(value * value * requests_num);
+            bool generated = cache.generateCover(requests[r], result);
+
+            mismatches += !sameResults(result, expected[r]) || generated != (result.error == GenErrors::COVER_OK);
+        }
+    };
+
+    sizeRange(29, count);
+
+    uint64_t hits = cache.returnHits();
+    uint64_t misses = cache.returnMisses();
+
+    std::vector<std::thread> threads;
+
+    for(unsigned t = 0; t < threads_num; ++t)
+        threads.emplace_back(sizeRange, 31 + t, count / threads_num);
+    for(std::thread & thread : threads)
+        thread.join();
+
+    std::cout << "CoverCache (" << capacity << " entries, " << requests_num << " requests): " << hits << " hits, "
+              << misses << " misses, " << threads_num << " threads: " << cache.returnHits() - hits << " hits, "
+              << cache.returnMisses() - misses << " misses, mismatches: " << mismatches << "\n";
+
+    return mismatches + (cache.returnSize() != capacity);
+}
+/*!
+ * \brief Replace the catalog of CoverCache while other threads are sizing
+ *
+ * Catalogs are swapped many times, while the threads size the random
+ * requests with the shared cache. Every result has to be the one of
+ * either catalog. After every replacement all requests are sized
+ * again by the replacing thread - cache cannot return any result of
+ * the replaced catalog (capacity fits all requests, so nothing is
+ * evicted).
+ *
+ * \return Number of the wrong and outdated results
+ */
+static size_t sizeReloaded(CatalogPtr first, CatalogPtr second, size_t reloads, unsigned threads_num)
+{
+    const int lowest[SizingInputsNum] = { 600, 300, 400, 200, 200, 200, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 2000, 900, 1400, 1500, 1500, 1500, 150, 150, 150, 150 };
+    const size_t requests_num = 1024;
+    const CatalogPtr catalogs[2] = { first, second };
+
+    std::mt19937 rng(37);
+    std::vector<SizingInput> requests(requests_num);
+    std::vector<SizingResult> expected[2];
+    size_t different = 0;
+
+    for(uint8_t c = 0; c < 2; ++c)
+        expected[c].resize(requests_num);
+
+    for(size_t r = 0; r < requests_num; ++r)
+    {
+        randomRequest(rng, lowest, highest, requests[r]);
+
+        for(uint8_t c = 0; c < 2; ++c)
+            CoverSizer(catalogs[c]).generateCover(requests[r], expected[c][r]);
+
+        different += !sameResults(expected[0][r], expected[1][r]);
+    }
+
+    CoverCache cache(first, requests_num);
+    std::atomic<bool> reloading(true);
+    std::atomic<size_t> mismatches(0);
+    std::atomic<uint64_t> sized(0);
+
+    auto sizeWhileReloading = [&](uint32_t seed)
+    {
+        std::mt19937 local_rng(seed);
+        std::uniform_int_distribution<size_t> draw(0, requests_num - 1);
+        SizingResult result;
+
+        while(reloading.load(std::memory_order_relaxed))
+        {
+            size_t r = draw(local_rng);
+            cache.generateCover(requests[r], result);
+
+            mismatches += !sameResults(result, expected[0][r]) && !sameResults(result, expected[1][r]);
+            sized.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for(unsigned t = 0; t < std::max(threads_num, 2u); ++t)
+        threads.emplace_back(sizeWhileReloading, 41 + t);
+
+    size_t outdated = 0;
+    SizingResult result;
+    // Po kilku zapytaniach innych wątków wszystkie wyniki muszą pochodzić z nowego katalogu
+    for(size_t i = 1; i <= reloads; ++i)
+    {
+        uint64_t previous = sized.load();
+
+        cache.setCatalog(catalogs[i % 2]);
+
+        while(sized.load() < previous + 64)
+            std::this_thread::yield();
+
+        for(size_t r = 0; r < requests_num; ++r)
+        {
+            cache.generateCover(requests[r], result);
+            outdated += !sameResults(result, expected[i % 2][r]);
+        }
+    }
+
+    reloading = false;
+
+    for(std::thread & thread : threads)
+        thread.join();
+
+    std::cout << "CoverCache reloaded " << reloads << " times while sizing (" << sized << " items, " << different
+              << " of " << requests_num << " results differ between catalogs), mismatches: " << mismatches
+              << ", outdated: " << outdated << "\n";
+
+    return mismatches + outdated;
+}
+/*!
+ * \brief Compare ProductFamilies with CoverSizer of every family
+ *
+ * Families use the variants of the catalog with different wall modules
+ * and stacks, so their results differ. Few families are sized in the
+ * calling thread, many families (more than one group of the tasks) on
+ * the pool of four threads, also on the machine with fewer cores. Every
+ * result and the number of the fitting families are compared with the
+ * generators of the families sized one by one.
+ *
+ * \return Number of the requests with different results
+ */
+static size_t sizeFamilies(const std::string & contents, size_t count)
+{
+    const int lowest[SizingInputsNum] = { 600, 300, 400, 200, 200, 200, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 2000, 900, 1400, 1500, 1500, 1500, 150, 150, 150, 150 };
+    const char *variants[] = { "",
+                               "\nmodule_heights : 193.4 386.7\n",
+                               "\nmodule_heights : 386.7 580.2\n",
+                               "\nmodule_heights : 193.4 386.7 580.2\n",
+                               "\nmodule_heights : 193.4 386.7\nstack_goal : 1\n",
+                               "\nmodule_heights : 193.4 386.7 580.2\nstack_goal : 1\n" };
+    const size_t families_nums[] = { 6, 700 };
+
+    std::vector<CatalogPtr> catalogs;
+
+    for(const char *variant : variants)
+    {
+        CatalogPtr variant_catalog = CoverCatalog::loadShared(contents + variant);
+
+        if(!variant_catalog)
+            return 1;
+
+        catalogs.push_back(variant_catalog);
+    }
+
+    WorkStealingPool pool(4);
+    size_t all_mismatches = 0;
+
+    for(size_t families_num : families_nums)
+    {
+        ProductFamilies families(&pool);
+        std::vector<CoverSizer> sizers;
+
+        for(size_t f = 0; f < families_num; ++f)
+        {
+            families.setFamily("family_" + std::to_string(f), catalogs[f % catalogs.size()]);
+            sizers.emplace_back(catalogs[f % catalogs.size()]);
+        }
+
+        std::mt19937 rng(43);
+        std::vector<SizingResult> results;
+        SizingInput request;
+        SizingResult expected;
+        size_t mismatches = 0;
+        double time = 0.0;
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            randomRequest(rng, lowest, highest, request);
+
+            auto start = std::chrono::steady_clock::now();
+            size_t fitting = families.generateCovers(request, results);
+            time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            size_t expected_fitting = 0;
+            bool same = results.size() == families_num;
+
+            for(size_t f = 0; same && f < families_num; ++f)
+            {
+                expected_fitting += sizers[f].generateCover(request, expected);
+                same = sameResults(results[f], expected);
+            }
+
+            mismatches += !same || fitting != expected_fitting;
+        }
+
+        std::cout << "ProductFamilies (" << families_num << " families, " << pool.returnThreadsNum() << " threads): "
+                  << count * families_num / time / 1e6 << " M items/s, mismatches: " << mismatches << "\n";
+
+        all_mismatches += mismatches;
+    }
+
+    return all_mismatches;
+}
+/*!
+ * \brief Compare the best covers of CoverOptimizer with all combinations of the parts
+ *
+ * Every width, depth and stack of the modules, which fits the required
+ * inner dimensions, is checked for the collisions (the same rules as in
+ * CoverSizer) and ranked. K best combinations have to be the same as the
+ * candidates of the optimizer, in the same order.
+ *
+ * \return Number of the requests with different candidates
+ */
+static size_t sizeOptimizer(CatalogPtr catalog, size_t count)
+{
+    const int lowest[SizingInputsNum] = { 600, 300, 400, 200, 200, 200, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 1900, 800, 1400, 1200, 1200, 1200, 150, 150, 150, 150 };
+
+    WorkStealingPool pool;
+    CoverSizer sizer(catalog);
+    CoverOptimizer optimizer(catalog, pool);
+    const CatalogIndex & index = catalog->returnIndex();
+
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int> top(1, 8);
+
+    size_t searched = 0;
+    size_t mismatches = 0;
+    double total_time = 0.0;
+
+    std::vector<CoverCandidate> candidates;
+    std::vector<CoverCandidate> all;
+    SizingResult request;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        SizingInput item;
+        randomRequest(rng, lowest, highest, item);
+
+        size_t top_k = top(rng);
+        OptimizerGoal goal = (i % 2) ? MIN_VOLUME : MIN_FOOTPRINT;
+
+        auto start = std::chrono::steady_clock::now();
+        optimizer.optimize(item, goal, top_k, candidates);
+        total_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Wszystkie kombinacje części
+        all.clear();
+        sizer.generateCover(item, request);
+
+        bool searchable = request.error == GenErrors::COVER_OK || request.error == GenErrors::LEFT_COLLISION ||
+                          request.error == GenErrors::RIGHT_COLLISION || request.error == GenErrors::BACK_COLLISION;
+        const SizingInput & input = request.input;
+
+        for(size_t l = 0; searchable && l < index.returnInnerDims(DIM_ID::LENGTH).size(); ++l)
+        {
+            int outer_length = index.returnOuterDims(DIM_ID::LENGTH)[l];
+
+            if(index.returnInnerDims(DIM_ID::LENGTH)[l] < request.approx_inner_dim[DIM_ID::LENGTH] ||
+               (input.obstacles[0] != -1 && input.device[0] / 2 + input.obstacles[0] <= outer_length / 2) ||
+               (input.obstacles[1] != -1 && input.device[0] / 2 + input.obstacles[1] <= outer_length / 2))
+                continue;
+
+            for(size_t w = 0; w < index.returnInnerDims(DIM_ID::WIDTH).size(); ++w)
+            {
+                int inner_width = index.returnInnerDims(DIM_ID::WIDTH)[w];
+                int outer_width = index.returnOuterDims(DIM_ID::WIDTH)[w];
+                int offset = inner_width / 2 - input.device[1] / 2 - input.spaces[2];
+
+                if(inner_width < request.approx_inner_dim[DIM_ID::WIDTH] ||
+                   (input.obstacles[2] != -1 && input.device[1] / 2 + input.obstacles[2] <= outer_width / 2 - offset))
+                    continue;
+
+                for(size_t n = 0; n < index.returnInnerHeights().size(); ++n)
+                {
+                    if(index.returnInnerHeights()[n] < request.approx_inner_dim[DIM_ID::HEIGHT])
+                        continue;
+
+                    CoverCandidate candidate;
+                    candidate.length_idx = static_cast<int>(l);
+                    candidate.width_idx = static_cast<int>(w);
+                    candidate.modules = static_cast<uint8_t>(2 * index.returnStackModules()[n]);
+                    candidate.score = static_cast<uint64_t>(outer_length) * outer_width;
+
+                    if(goal == MIN_VOLUME)
+                        candidate.score *= index.returnOuterHeights()[n];
+
+                    all.push_back(candidate);
+                }
+            }
+        }
+
+        std::sort(all.begin(), all.end(), CoverOptimizer::isBetter);
+
+        if(all.size() > top_k)
+            all.resize(top_k);
+
+        bool same = all.size() == candidates.size();
+
+        for(size_t c = 0; same && c < all.size(); ++c)
+        {
+            same = all[c].length_idx == candidates[c].length_idx && all[c].width_idx == candidates[c].width_idx &&
+                   all[c].modules == candidates[c].modules && all[c].score == candidates[c].score;
+        }
+
+        searched += !all.empty();
+        mismatches += !same;
+    }
+
+    std::cout << "Optimizer (" << (index.returnInnerHeights().size()) << " stacks): " << searched << " of " << count
+              << " requests with candidates, mean " << (count ? total_time / count * 1e6 : 0.0)
+              << " us, mismatches: " << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Search the nearest data giving the standard cover for the failed requests
+ *
+ * Requests are drawn from the ranges of the typical data. Suggested
+ * changes are applied to the request, which has to give the standard
+ * cover then. Prints the share of the failures, which can be fixed
+ * by the change of the spaces and obstacles, and the duration of the search.
+ *
+ * \return Number of suggestions, which do not give the standard cover
+ */
+static size_t sizeRelaxations(const CoverSizer & sizer, size_t count)
+{
+    // Zakresy typowych danych (urządzenie, przeszkody, odstępy)
+    const int lowest[SizingInputsNum] = { 800, 400, 500, 300, 300, 300, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 2100, 950, 1400, 1500, 1500, 1500, 150, 150, 150, 150 };
+
+    std::mt19937 rng(11);
+
+    size_t failed = 0;
+    size_t fixed = 0;
+    size_t mismatches = 0;
+    uint16_t max_evaluations = 0;
+    double total_time = 0.0;
+    double max_time = 0.0;
+
+    RelaxationResult relaxation;
+    SizingResult result;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        SizingInput item;
+        randomRequest(rng, lowest, highest, item);
+
+        if(sizer.generateCover(item, result))
+            continue;
+
+        ++failed;
+
+        auto start = std::chrono::steady_clock::now();
+        bool found = RelaxationSearch::findNearestFeasible(sizer, item, relaxation);
+        double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        total_time += time;
+        max_time = (time > max_time) ? time : max_time;
+        max_evaluations = (relaxation.evaluations > max_evaluations) ? relaxation.evaluations : max_evaluations;
+
+        if(!found)
+            continue;
+
+        ++fixed;
+        // Dane z naniesionymi zmianami
+        for(uint8_t c = 0; c < relaxation.changes_num; ++c)
+        {
+            const InputChange & change = relaxation.changes[c];
+
+            if(change.input < LEFT_OBSTACLE)
+                item.spaces[change.input] = change.to;
+            else
+                item.obstacles[change.input - LEFT_OBSTACLE] = change.to;
+        }
+
+        mismatches += !sizer.generateCover(item, result) || relaxation.changes_num == 0 ||
+                      result.outer_dim[DIM_ID::LENGTH] != relaxation.result.outer_dim[DIM_ID::LENGTH] ||
+                      result.outer_dim[DIM_ID::WIDTH] != relaxation.result.outer_dim[DIM_ID::WIDTH] ||
+                      result.outer_dim[DIM_ID::HEIGHT] != relaxation.result.outer_dim[DIM_ID::HEIGHT];
+    }
+
+    std::cout << "Nearest feasible data: " << fixed << " of " << failed << " failures fixed by spaces / obstacles, mean "
+              << (failed ? total_time / failed * 1e6 : 0.0) << " us, max " << max_time * 1e6 << " us, max generations "
+              << max_evaluations << ", mismatches: " << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Check the sizes of the covers (S, M, L, XL) of every stack of the modules
+ *
+ * Size has to grow with the height of the stack and be equal to the
+ * number of the modules on each wall (at most XL) for the stacks of
+ * the standard modules only, also in the catalog with many types of
+ * the modules. Prints the number of the stacks of each size.
+ *
+ * \return Number of the stacks with the wrong size
+ */
+static size_t sizeCoverSizes(CatalogPtr catalog)
+{
+    const CatalogIndex & index = catalog->returnIndex();
+    const std::vector<FixedDim> & modules = catalog->returnModuleHeights();
+    FixedDim standard = catalog->returnBaseDimensions(DIM_ID::HEIGHT)[1];
+    // Bez listy modułów jedynym typem jest moduł standardowy
+    size_t standard_type = modules.size();
+
+    for(size_t t = 0; t < modules.size(); ++t)
+    {
+        if(truncToMm(modules[t]) == truncToMm(standard))
+            standard_type = t;
+    }
+
+    if(modules.empty())
+        standard_type = 0;
+
+    size_t mismatches = 0;
+    size_t counts[CoverSizesNum] = {};
+    COVER_SIZE previous = SIZE_S;
+
+    for(size_t s = 0; s < index.returnInnerHeights().size(); ++s)
+    {
+        COVER_SIZE size = index.findCoverSize(index.returnInnerHeights()[s]);
+        int stack_modules = index.returnStackModules()[s];
+        bool only_standard = standard_type < index.returnModuleTypesNum() &&
+                             index.returnModuleCount(static_cast<int>(s), standard_type) == stack_modules;
+
+        mismatches += size < previous || (only_standard && size != std::min<int>(stack_modules, SIZE_XL));
+        previous = size;
+        ++counts[size];
+    }
+
+    std::cout << "Cover sizes (" << index.returnModuleTypesNum() << " types of modules): S " << counts[SIZE_S]
+              << ", M " << counts[SIZE_M] << ", L " << counts[SIZE_L] << ", XL " << counts[SIZE_XL]
+              << " stacks, mismatches: " << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Analyze the typical requests with the inaccurate measurements
+ *
+ * Device and obstacles are measured with the uniform error of 20 mm.
+ * Counters of the results have to cover all samples and be the same
+ * for the pool of all hardware threads and the single thread. Prints
+ * the share of the borderline requests (less than 95% of the samples
+ * with the same result as the typed data) and the duration of the analysis.
+ *
+ * \return Number of the analyses with the inconsistent counters
+ */
+static size_t sizeTolerances(CatalogPtr catalog, size_t count)
+{
+    const int lowest[SizingInputsNum] = { 800, 400, 500, 300, 300, 300, 0, 0, 0, 0 };
+    const int highest[SizingInputsNum] = { 1800, 800, 1300, 1500, 1500, 1500, 150, 150, 150, 150 };
+
+    WorkStealingPool pool;
+    WorkStealingPool single_pool(1);
+    ToleranceAnalysis analysis(catalog, pool);
+    ToleranceAnalysis single_analysis(catalog, single_pool);
+    ToleranceSettings settings = ToleranceAnalysis::returnMeasurementSettings(TOLERANCE_UNIFORM, 20);
+
+    std::mt19937 rng(13);
+
+    size_t borderline = 0;
+    size_t mismatches = 0;
+    double total_time = 0.0;
+    double max_time = 0.0;
+
+    ToleranceResult result;
+    ToleranceResult single_result;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        SizingInput item;
+        randomRequest(rng, lowest, highest, item);
+
+        settings.seed = i + 1;
+        analysis.analyze(item, settings, result);
+        single_analysis.analyze(item, settings, single_result);
+
+        total_time += result.seconds;
+        max_time = (result.seconds > max_time) ? result.seconds : max_time;
+        borderline += ToleranceAnalysis::returnShare(result, result.nominal_count) < 0.95;
+
+        uint32_t errors_sum = 0;
+        uint32_t sizes_sum = 0;
+        bool same = result.nominal_count == single_result.nominal_count;
+
+        for(uint8_t e = 0; e <= GenErrors::COVER_OK; ++e)
+        {
+            errors_sum += result.errors[e];
+            same = same && (result.errors[e] == single_result.errors[e]);
+        }
+
+        for(uint8_t c = 0; c < CoverSizesNum; ++c)
+            sizes_sum += result.sizes[c];
+
+        mismatches += !same || errors_sum != settings.samples || sizes_sum != result.errors[GenErrors::COVER_OK] ||
+                      result.nominal_count > settings.samples;
+    }
+
+    std::cout << "Tolerance analysis (+-20 mm, " << settings.samples << " samples): " << borderline << " of " << count
+              << " requests borderline, mean " << (count ? total_time / count * 1e3 : 0.0) << " ms, max "
+              << max_time * 1e3 << " ms, mismatches: " << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Lay out the random rows of heat pumps and compare with all groupings
+ *
+ * Every grouping of the row (2 to 6 heat pumps) is sized one by one
+ * with the same obstacles as in the search. Best sum of the footprints
+ * and the number of covers have to be the same as the ones of the solver.
+ *
+ * \return Number of the rows with different layouts
+ */
+static size_t sizeRows(CatalogPtr catalog, size_t count)
+{
+    WorkStealingPool pool;
+    RowLayoutSolver solver(catalog, pool);
+
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> units_num(2, 6);
+    std::uniform_int_distribution<int> width(400, 1000);
+    std::uniform_int_distribution<int> depth(300, 500);
+    std::uniform_int_distribution<int> height(500, 1300);
+    std::uniform_int_distribution<int> gap(100, 700);
+    std::uniform_int_distribution<int> back(200, 800);
+    std::uniform_int_distribution<int> given(0, 3);
+
+    size_t found = 0;
+    size_t shared = 0;
+    size_t mismatches = 0;
+    double total_time = 0.0;
+    double max_time = 0.0;
+
+    RowLayout layout;
+    SizingResult group;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        RowSite site;
+        site.units.resize(units_num(rng));
+        site.wall_length = 0;
+
+        for(RowUnit & unit : site.units)
+        {
+            unit.device[DIM_ID::LENGTH] = width(rng);
+            unit.device[DIM_ID::WIDTH] = depth(rng);
+            unit.device[DIM_ID::HEIGHT] = height(rng);
+            unit.gap = gap(rng);
+            site.wall_length += unit.gap + unit.device[DIM_ID::LENGTH];
+        }
+
+        site.wall_length += gap(rng);
+        site.back_distance = given(rng) ? back(rng) : -1;
+
+        bool solved = solver.solve(site, MIN_FOOTPRINT, layout);
+
+        total_time += layout.seconds;
+        max_time = (layout.seconds > max_time) ? layout.seconds : max_time;
+        found += solved;
+        shared += solved && layout.covers.size() < site.units.size();
+
+        // Wszystkie podziały rzędu (bit - koniec obudowy po danej pompie)
+        int last_unit = static_cast<int>(site.units.size()) - 1;
+        uint64_t best_score = 0;
+        size_t best_covers = 0;
+        bool best_found = false;
+
+        for(uint32_t cuts = 0; cuts < (1u << last_unit); ++cuts)
+        {
+            uint64_t score = 0;
+            size_t covers = 0;
+            int overhang = 0;
+            int first = 0;
+            bool feasible = true;
+
+            for(int unit = 0; unit <= last_unit && feasible; ++unit)
+            {
+                if(unit < last_unit && !(cuts & (1u << unit)))
+                    continue;
+
+                feasible = solver.sizeGroup(site, first, unit, overhang, group);
+                score += static_cast<uint64_t>(group.outer_dim[DIM_ID::LENGTH]) * group.outer_dim[DIM_ID::WIDTH];
+                overhang = RowLayoutSolver::returnOverhang(group);
+                first = unit + 1;
+                ++covers;
+            }
+
+            if(feasible && (!best_found || score < best_score || (score == best_score && covers < best_covers)))
+            {
+                best_score = score;
+                best_covers = covers;
+                best_found = true;
+            }
+        }
+
+        mismatches += (solved != best_found) ||
+                      (solved && (layout.score != best_score || layout.covers.size() != best_covers));
+    }
+
+    std::cout << "Row layouts: " << found << " of " << count << " rows covered (" << shared << " with shared covers), mean "
+              << (count ? total_time / count * 1e6 : 0.0) << " us, max " << max_time * 1e6 << " us, mismatches: "
+              << mismatches << "\n";
+
+    return mismatches;
+}
+/*!
+ * \brief Measure the time of loading the large catalog (parsing, sorting and index)
+ *
+ * Widths and depths of the given catalog are replaced by the dense
+ * series of the parts (every 0.5 mm and 0.2 mm), the other parameters
+ * are copied from the given text.
+ *
+ * \param[in] contents - text of the given catalog
+ * \param[out] large_size - number of bytes of the large catalog
+ * \return Time of loading in seconds or a negative value if not loaded
+ */
+static double timeLargeCatalog(const std::string & contents, size_t & large_size)
+{
+    std::ostringstream text;
+
+    text << "lengths :";
+    for(int i = 0; i < LargeCatalogParts; ++i)
+        text << " " << 1000 + i / 2 << ((i % 2) ? ".5" : "");
+
+    text << "\nwidths :";
+    for(int i = 0; i < LargeCatalogParts; ++i)
+        text << " " << 500 + i / 5 << "." << (i % 5) * 2;
+
+    text << "\n";
+
+    std::istringstream lines(contents);
+    std::string line;
+
+    while(std::getline(lines, line))
+    {
+        if(line.compare(0, 7, "lengths") != 0 && line.compare(0, 6, "widths") != 0)
+            text << line << "\n";
+    }
+
+    std::string large = text.str();
+    large_size = large.size();
+
+    if(!CoverCatalog::loadShared(large))
+        return -1;
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < TimedLoads / 10; ++i)
+        CoverCatalog::loadShared(large);
+
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / (TimedLoads / 10);
+}
+/*!
+ * \brief Count the items with results different from the reference
+ */
+static size_t countMismatches(const BenchBuffers & reference, const BenchBuffers & tested, size_t count)
+{
+    size_t mismatches = 0;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        bool same = reference.modules[i] == tested.modules[i] && reference.errors[i] == tested.errors[i];
+
+        for(int c = 0; c < 2 * DimNum; ++c)
+            same = same && reference.dims[c][i] == tested.dims[c][i];
+
+        mismatches += !same;
+    }
+
+    return mismatches;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *catalog_path = (argc > 1) ? argv[1] : HPSIZING_DEFAULT_CATALOG;
+    size_t count = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 4000000;
+
+    std::string contents;
+    CatalogPtr catalog;
+
+    if(readFile(catalog_path, contents))
+        catalog = CoverCatalog::loadShared(contents);
+
+    if(!catalog)
+    {
+        std::cerr << "Unable to load the catalog: " << catalog_path << "\n";
+        return 2;
+    }
+
+    BenchBuffers reference(count);
+    BenchBuffers tested(count);
+
+    randomInputs(reference, count);
+    for(int c = 0; c < InputColumns; ++c)
+        tested.inputs[c] = reference.inputs[c];
+
+    CoverSizer sizer(catalog);
+
+    auto start = std::chrono::steady_clock::now();
+    sizeReference(sizer, reference, 0, count, false, false);
+    double reference_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "CoverSizer (reference): " << count / reference_time / 1e6 << " M items/s\n";
+
+    // Jeden generator i jeden katalog współdzielone przez wszystkie wątki
+    unsigned threads_num = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+
+    start = std::chrono::steady_clock::now();
+    sizeReferenceParallel(sizer, tested, count, threads_num);
+    double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t mismatches = countMismatches(reference, tested, count);
+    bool all_correct = (mismatches == 0);
+
+    std::cout << "CoverSizer (" << threads_num << " threads): " << count / time / 1e6 << " M items/s, x"
+              << reference_time / time << " vs reference, mismatches: " << mismatches << "\n";
+
+    // Katalog wkompilowany w program musi dawać te same wyniki co domyślny plik
+    if(EmbeddedCatalog::isAvailable() && argc < 2)
+    {
+        start = std::chrono::steady_clock::now();
+        CatalogPtr embedded_catalog = EmbeddedCatalog::load();
+        double load_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        CoverSizer embedded_sizer(embedded_catalog);
+        sizeReference(embedded_sizer, tested, 0, count, false, false);
+        mismatches = countMismatches(reference, tested, count);
+        all_correct = all_correct && (mismatches == 0);
+
+        std::cout << "Embedded catalog: first load " << load_time * 1e6 << " us, mismatches: " << mismatches << "\n";
+    }
+
+    // Katalog skompilowany (CatalogBlob) musi dawać te same wyniki co plik tekstowy
+    std::string blob = CatalogBlob::compile(*catalog);
+    CatalogPtr compiled_catalog = CatalogBlob::load(blob.data(), blob.size());
+    mismatches = count;
+
+    if(compiled_catalog)
+    {
+        CoverSizer compiled_sizer(compiled_catalog);
+        sizeReference(compiled_sizer, tested, 0, count, false, false);
+        mismatches = countMismatches(reference, tested, count);
+    }
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < TimedLoads; ++i)
+        CoverCatalog::loadShared(contents);
+    double text_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < TimedLoads; ++i)
+        CatalogBlob::load(blob.data(), blob.size());
+    double compiled_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t large_size = 0;
+    double large_time = timeLargeCatalog(contents, large_size);
+    all_correct = all_correct && (mismatches == 0) && (large_time >= 0);
+
+    std::cout << "Compiled catalog (" << blob.size() << " bytes): load time text " << text_time / TimedLoads * 1e6
+              << " us, compiled " << compiled_time / TimedLoads * 1e6 << " us, mismatches: " << mismatches << "\n"
+              << "Large catalog (" << 2 * LargeCatalogParts << " parts, " << large_size << " bytes): "
+              << large_time * 1e6 << " us, " << large_size / large_time / 1e6 << " MB/s\n";
+
+    mismatches = sizeSweep(sizer, count);
+    all_correct = all_correct && (mismatches == 0);
+
+    mismatches = sizeCached(catalog, 300000, threads_num);
+    all_correct = all_correct && (mismatches == 0);
+
+    BatchSizer batch(*catalog);
+    const KernelIsa all_isa[] = { ISA_SCALAR, ISA_SSE42, ISA_AVX2, ISA_WASM128 };
+
+    for(KernelIsa isa : all_isa)
+    {
+        if(!batch.returnKernel().setIsa(isa))
+            continue;
+
+        start = std::chrono::steady_clock::now();
+        batch.sizeBatch(tested.in, tested.out, count);
+        time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        mismatches = countMismatches(reference, tested, count);
+        all_correct = all_correct && (mismatches == 0);
+
+        std::cout << "SizingKernel (" << SizingKernel::isaName(isa) << "): "
+                  << count / time / 1e6 << " M items/s, x" << reference_time / time
+                  << " vs reference, mismatches: " << mismatches << "\n";
+    }
+
+    // Przesunięcie urządzenia przy kolizji z boku (partia i CoverSizer)
+    size_t collisions = 0;
+
+    for(size_t i = 0; i < count; ++i)
+        collisions += (reference.errors[i] == GenErrors::LEFT_COLLISION || reference.errors[i] == GenErrors::RIGHT_COLLISION);
+
+    sizeReference(sizer, reference, 0, count, true, false);
+    batch.returnKernel().setIsa(SizingKernel::detectIsa());
+    tested.out.shift = tested.shifts.data();
+
+    start = std::chrono::steady_clock::now();
+    batch.sizeBatch(tested.in, tested.out, count);
+    time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    mismatches = countMismatches(reference, tested, count);
+    size_t placed = 0;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        mismatches += (reference.shifts[i] != tested.shifts[i]) && reference.errors[i] == tested.errors[i];
+        placed += (tested.shifts[i] != 0);
+    }
+
+    all_correct = all_correct && (mismatches == 0);
+
+    std::cout << "Off-center placement: " << placed << " of " << collisions << " side collisions avoided, "
+              << count / time / 1e6 << " M items/s, mismatches: " << mismatches << "\n";
+
+    // Obrót urządzenia o 90 stopni (obie orientacje w tej samej partii)
+    size_t special_typed = 0;
+
+    for(size_t i = 0; i < count; ++i)
+        special_typed += (reference.errors[i] != GenErrors::COVER_OK);
+
+    sizeReference(sizer, reference, 0, count, true, true);
+    tested.out.rotated = tested.rotations.data();
+
+    start = std::chrono::steady_clock::now();
+    batch.sizeBatch(tested.in, tested.out, count);
+    time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    mismatches = countMismatches(reference, tested, count);
+    size_t special_rotated = 0;
+    size_t rotated = 0;
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        mismatches += (reference.rotations[i] != tested.rotations[i]) ||
+                      ((reference.shifts[i] != tested.shifts[i]) && reference.errors[i] == tested.errors[i]);
+        special_rotated += (tested.errors[i] != GenErrors::COVER_OK);
+        rotated += tested.rotations[i];
+    }
+
+    all_correct = all_correct && (mismatches == 0);
+
+    std::cout << "Rotation: " << rotated << " devices rotated, special covers " << special_typed << " -> " << special_rotated
+              << ", " << count / time / 1e6 << " M items/s, mismatches: " << mismatches << "\n";
+
+    // Katalog z modułami połówkowymi i wysokimi (równe wyniki z różną liczbą modułów)
+    CatalogPtr modules_catalog = CoverCatalog::loadShared(contents + "\nmodule_heights : 193.4 386.7 580.2\n");
+
+    mismatches = sizeOptimizer(catalog, 10000);
+    all_correct = all_correct && (mismatches == 0);
+
+    if(modules_catalog)
+    {
+        mismatches = sizeOptimizer(modules_catalog, 10000);
+        all_correct = all_correct && (mismatches == 0);
+
+        mismatches = sizeReloaded(catalog, modules_catalog, 500, threads_num);
+        all_correct = all_correct && (mismatches == 0);
+    }
+
+    mismatches = sizeFamilies(contents, 2000);
+    all_correct = all_correct && (mismatches == 0);
+
+    mismatches = sizeRelaxations(sizer, count / 10);
+    all_correct = all_correct && (mismatches == 0);
+
+    mismatches = sizeCoverSizes(catalog);
+    all_correct = all_correct && (mismatches == 0);
+
+    if(modules_catalog)
+    {
+        mismatches = sizeCoverSizes(modules_catalog);
+        all_correct = all_correct && (mismatches == 0);
+    }
+
+    mismatches = sizeTolerances(catalog, 200);
+    all_correct = all_correct && (mismatches == 0);
+
+    mismatches = sizeRows(catalog, 2000);
+    all_correct = all_correct && (mismatches == 0);
+
+    return all_correct ? 0 : 1;
+}
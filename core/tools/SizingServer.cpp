@@ -0,0 +1,559 @@
+/*!
+ * \file
+ * \brief Local HTTP sizing service
+ *
+ * Serves the generator over HTTP/JSON on the localhost (e.g. for
+ * the web shop), without the Qt interface. Endpoints:
+ * - POST /quote - one quote (SizingService::answerQuote),
+ * - POST /batch - array of quotes sized at once (SizingService::answerBatch),
+ * - GET /stats - number of requests and p50 / p99 latency of each endpoint,
+ * - GET /health - state of the service.
+ * Connections are kept alive (HTTP/1.1) and served by the fixed
+ * pool of threads waiting on one epoll instance (every connection
+ * is armed for one thread at a time), all of them sharing one
+ * catalog. Answers, which do not fit into the socket, wait in the
+ * connection until it is writable again, so no thread waits for the
+ * slow client. Failing accept (e.g. no free descriptors) pauses
+ * accepting for a moment instead of spinning. Stops after SIGINT / SIGTERM and prints the counters.
+ *
+ * Usage: hpsizing_server [catalog_path] [port] [threads] [messages_path]
+ */
+
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#include "SizingService.hpp"
+
+/*!
+ * \brief Default path to the parameters of the generator
+ */
+#ifndef HPSIZING_DEFAULT_CATALOG
+#define HPSIZING_DEFAULT_CATALOG "resources/txt/CoverParameters.txt"
+#endif
+/*!
+ * \brief Default path to the error messages of the generator
+ */
+#ifndef HPSIZING_DEFAULT_MESSAGES
+#define HPSIZING_DEFAULT_MESSAGES "resources/txt/GenErrorMsgs.txt"
+#endif
+
+/*!
+ * \brief Default port of the service
+ */
+static constexpr int DefaultPort = 8088;
+/*!
+ * \brief Maximum size of the headers of the request
+ */
+static constexpr size_t MaxHeaderBytes = 8192;
+/*!
+ * \brief Maximum size of the body of the request
+ */
+static constexpr size_t MaxBodyBytes = 16 << 20;
+/*!
+ * \brief Period of checking the stop flag by the threads [ms]
+ */
+static constexpr int StopCheckPeriod = 200;
+/*!
+ * \brief Pause of accepting the connections after the failed accept [ms]
+ */
+static constexpr int AcceptBackoff = 100;
+
+/*!
+ * \brief Connection of the client (or the listening socket)
+ */
+struct Connection
+{
+    /*! Socket of the connection */
+    int fd = -1;
+    /*! True for the listening socket */
+    bool listener = false;
+    /*! Received bytes, which have not been answered yet */
+    std::string received;
+    /*! Answers to send (the rest, which has not fitted into the socket) */
+    std::string answers;
+    /*! True if the connection is closed after sending the answers */
+    bool closing = false;
+    /*! Timer arming the listening socket again after the pause (only for the listening socket) */
+    int backoff_fd = -1;
+    /*! Descriptor kept in reserve for the lack of the descriptors (only for the listening socket) */
+    int spare_fd = -1;
+    /*! True after the failed accept, until the next accepted connection (only for the listening socket) */
+    bool failing = false;
+    /*! Listening socket armed again by this timer (only for the timer of the pause) */
+    Connection *paused = nullptr;
+};
+
+/*!
+ * \brief True after SIGINT / SIGTERM
+ */
+static std::atomic<bool> stopping(false);
+
+/*!
+ * \brief Set the stop flag (signal handler)
+ */
+static void stopService(int)
+{
+    stopping = true;
+}
+/*!
+ * \brief Read the whole file into the string
+ */
+static bool readFile(const char *path, std::string & contents)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    contents = buffer.str();
+
+    return true;
+}
+/*!
+ * \brief Compare the beginning of the text with the lowercase prefix (ignoring the case)
+ */
+static bool startsWith(const char *text, const char *end, const char *prefix)
+{
+    for(; *prefix != '\0'; ++text, ++prefix)
+    {
+        if(text == end || (*text | 0x20) != *prefix)
+            return false;
+    }
+
+    return true;
+}
+/*!
+ * \brief Send as much of the answers as the socket takes (sent bytes are removed)
+ */
+static bool sendAnswers(Connection & connection)
+{
+    size_t sent = 0;
+    bool correct = true;
+
+    while(sent < connection.answers.size())
+    {
+        ssize_t result = send(connection.fd, connection.answers.data() + sent, connection.answers.size() - sent,
+                              MSG_NOSIGNAL);
+
+        if(result > 0)
+            sent += result;
+        else if(result < 0 && errno == EINTR)
+            continue;
+        else
+        {
+            // Pełne gniazdo - reszta po EPOLLOUT
+            correct = result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+            break;
+        }
+    }
+
+    connection.answers.erase(0, sent);
+
+    return correct;
+}
+/*!
+ * \brief Append the HTTP answer with the JSON body
+ */
+static void appendAnswer(std::string & answers, int status, const std::string & body, bool keep_alive)
+{
+    const char *reason = "OK";
+
+    switch(status)
+    {
+        case 400:
+            reason = "Bad Request";
+            break;
+        case 404:
+            reason = "Not Found";
+            break;
+        case 405:
+            reason = "Method Not Allowed";
+            break;
+        case 413:
+            reason = "Payload Too Large";
+            break;
+        default:
+            break;
+    }
+
+    answers += "HTTP/1.1 " + std::to_string(status) + " " + reason + "\r\nContent-Type: application/json\r\n"
+               "Content-Length: " + std::to_string(body.size()) + "\r\nConnection: " +
+               (keep_alive ? "keep-alive" : "close") + "\r\n\r\n";
+    answers += body;
+}
+/*!
+ * \brief Answer all complete requests of the connection
+ *
+ * Requests sent one after another without waiting (pipelining) are
+ * answered in order. Incomplete request stays in the buffer.
+ *
+ * \return False if the connection has to be closed
+ */
+static bool serveRequests(Connection & connection, SizingService & service)
+{
+    std::string body;
+    bool keep_alive = true;
+
+    while(keep_alive)
+    {
+        size_t header_end = connection.received.find("\r\n\r\n");
+
+        if(header_end == std::string::npos)
+        {
+            if(connection.received.size() > MaxHeaderBytes)
+                return false;
+
+            break;
+        }
+
+        const char *header = connection.received.data();
+        const char *header_stop = header + header_end;
+        const char *method_end = static_cast<const char *>(std::memchr(header, ' ', header_end));
+        const char *path_end = (method_end == nullptr) ? nullptr :
+                               static_cast<const char *>(std::memchr(method_end + 1, ' ', header_stop - method_end - 1));
+
+        if(path_end == nullptr)
+            return false;
+
+        std::string method(header, method_end);
+        std::string path(method_end + 1, path_end);
+        size_t content_length = 0;
+        // HTTP/1.0 domyślnie zamyka połączenie
+        keep_alive = !startsWith(path_end + 1, header_stop, "http/1.0");
+
+        for(const char *line = header; line < header_stop; )
+        {
+            const char *line_end = static_cast<const char *>(std::memchr(line, '\n', header_stop - line));
+            line = (line_end == nullptr) ? header_stop : line_end + 1;
+
+            if(startsWith(line, header_stop, "content-length:"))
+                content_length = std::strtoull(line + 15, nullptr, 10);
+            else if(startsWith(line, header_stop, "connection:"))
+            {
+                const char *value = line + 11;
+
+                while(value < header_stop && *value == ' ')
+                    ++value;
+
+                keep_alive = startsWith(value, header_stop, "keep-alive") ||
+                             (keep_alive && !startsWith(value, header_stop, "close"));
+            }
+        }
+
+        if(content_length > MaxBodyBytes)
+        {
+            appendAnswer(connection.answers, 413, "{\"error\":\"request too large\"}", false);
+            return false;
+        }
+
+        size_t request_end = header_end + 4 + content_length;
+
+        if(connection.received.size() < request_end)
+            break;
+
+        const char *content = connection.received.data() + header_end + 4;
+        int status = 200;
+
+        if(path == "/quote" || path == "/batch")
+        {
+            if(method != "POST")
+            {
+                status = 405;
+                body = "{\"error\":\"use POST\"}";
+            }
+            else if(path == "/quote")
+                status = service.answerQuote(content, content_length, body);
+            else
+                status = service.answerBatch(content, content_length, body);
+        }
+        else if(path == "/stats" && method == "GET")
+            service.answerStats(body);
+        else if(path == "/health" && method == "GET")
+            body = "{\"status\":\"ok\"}";
+        else
+        {
+            status = 404;
+            body = "{\"error\":\"unknown endpoint\"}";
+        }
+
+        appendAnswer(connection.answers, status, body, keep_alive);
+        connection.received.erase(0, request_end);
+    }
+
+    return keep_alive;
+}
+/*!
+ * \brief Accept all waiting connections of the listening socket
+ *
+ * Connections are accepted until the queue is empty (EAGAIN). Without
+ * the free descriptors (EMFILE / ENFILE) the spare descriptor is closed
+ * to accept and close the waiting client at once, so it is not left in
+ * the queue. After the other errors accepting is paused for AcceptBackoff
+ * (the listening socket is armed again by the timer), so the threads do
+ * not spin on the failing accept. The error is logged once, until the
+ * next accepted connection.
+ *
+ * \return True if the listening socket can be armed again at once
+ */
+static bool acceptConnections(int epoll_fd, Connection & listener, std::mutex & connections_lock,
+                              std::unordered_map<int, std::unique_ptr<Connection>> & connections)
+{
+    while(true)
+    {
+        int client_fd = accept4(listener.fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if(client_fd < 0)
+        {
+            int error = errno;
+
+            if(error == EAGAIN || error == EWOULDBLOCK)
+                return true;
+            // Klient zerwał połączenie w kolejce
+            if(error == EINTR || error == ECONNABORTED)
+                continue;
+
+            if(!listener.failing)
+            {
+                std::cerr << "Unable to accept the connection: " << std::strerror(error) << "\n";
+                listener.failing = true;
+            }
+            // Brak deskryptorów - odrzucenie oczekującego klienta przez zapasowy deskryptor
+            if((error == EMFILE || error == ENFILE) && listener.spare_fd >= 0)
+            {
+                close(listener.spare_fd);
+                client_fd = accept4(listener.fd, nullptr, nullptr, SOCK_CLOEXEC);
+
+                if(client_fd >= 0)
+                    close(client_fd);
+
+                listener.spare_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+            }
+            // Wznowienie po przerwie (jednorazowy timer)
+            itimerspec pause = {};
+            pause.it_value.tv_nsec = AcceptBackoff * 1000000L;
+
+            return timerfd_settime(listener.backoff_fd, 0, &pause, nullptr) != 0;
+        }
+
+        listener.failing = false;
+
+        int no_delay = 1;
+        setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+        std::unique_ptr<Connection> client = std::make_unique<Connection>();
+        client->fd = client_fd;
+
+        epoll_event client_event = {};
+        client_event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+        client_event.data.ptr = client.get();
+        {
+            std::lock_guard<std::mutex> guard(connections_lock);
+            connections[client_fd] = std::move(client);
+        }
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_fd, &client_event);
+    }
+}
+/*!
+ * \brief Main loop of the thread of the pool
+ *
+ * Every socket is registered with EPOLLONESHOT, so it is given to one
+ * thread at a time and armed again after serving. Listening socket
+ * accepts all waiting connections at once. Connection with the unsent
+ * answers is armed for writing only, so the next requests are not read
+ * until the client takes the previous answers.
+ */
+static void serveLoop(int epoll_fd, SizingService & service, std::mutex & connections_lock,
+                      std::unordered_map<int, std::unique_ptr<Connection>> & connections)
+{
+    char buffer[65536];
+
+    while(!stopping)
+    {
+        epoll_event event;
+
+        if(epoll_wait(epoll_fd, &event, 1, StopCheckPeriod) != 1)
+            continue;
+
+        Connection & connection = *static_cast<Connection *>(event.data.ptr);
+
+        if(connection.paused != nullptr)
+        {
+            // Koniec przerwy - ponowne uzbrojenie gniazda nasłuchującego
+            uint64_t expirations;
+
+            if(read(connection.fd, &expirations, sizeof(expirations)) == sizeof(expirations))
+            {
+                epoll_event listener_event = {};
+                listener_event.events = EPOLLIN | EPOLLONESHOT;
+                listener_event.data.ptr = connection.paused;
+                epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.paused->fd, &listener_event);
+            }
+            continue;
+        }
+
+        if(connection.listener)
+        {
+            if(acceptConnections(epoll_fd, connection, connections_lock, connections))
+            {
+                event.events = EPOLLIN | EPOLLONESHOT;
+                epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+            }
+            continue;
+        }
+        // Najpierw reszta poprzednich odpowiedzi
+        bool open = sendAnswers(connection);
+
+        if(open && connection.answers.empty() && !connection.closing)
+        {
+            // Odczyt wszystkich dostępnych danych (koniec danych - zamknięcie po odpowiedziach)
+            while(true)
+            {
+                ssize_t received = recv(connection.fd, buffer, sizeof(buffer), 0);
+
+                if(received > 0)
+                    connection.received.append(buffer, received);
+                else
+                {
+                    connection.closing = received == 0;
+                    open = received == 0 || errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+                    break;
+                }
+            }
+
+            if(!serveRequests(connection, service))
+                connection.closing = true;
+
+            open = sendAnswers(connection) && open;
+        }
+
+        if(open && (!connection.answers.empty() || !connection.closing))
+        {
+            // Oczekiwanie na zapis bez EPOLLRDHUP (stan zamkniętego odczytu zgłaszany bez przerwy)
+            event.events = (connection.answers.empty() ? EPOLLIN | EPOLLRDHUP : EPOLLOUT) | EPOLLONESHOT;
+            epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+            continue;
+        }
+
+        int fd = connection.fd;
+        close(fd);
+
+        std::lock_guard<std::mutex> guard(connections_lock);
+        connections.erase(fd);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *catalog_path = (argc > 1) ? argv[1] : HPSIZING_DEFAULT_CATALOG;
+    int port = (argc > 2) ? std::atoi(argv[2]) : DefaultPort;
+    unsigned threads_num = (argc > 3) ? static_cast<unsigned>(std::atoi(argv[3])) : std::thread::hardware_concurrency();
+    const char *messages_path = (argc > 4) ? argv[4] : HPSIZING_DEFAULT_MESSAGES;
+
+    std::string contents;
+    CatalogPtr catalog;
+
+    if(readFile(catalog_path, contents))
+        catalog = CoverCatalog::loadShared(contents);
+
+    if(!catalog)
+    {
+        std::cerr << "Unable to load the catalog: " << catalog_path << "\n";
+        return 2;
+    }
+
+    SizingService service(catalog);
+
+    if(!readFile(messages_path, contents) || !service.setMessages(contents))
+        std::cerr << "Messages not loaded (" << messages_path << "), answers have only the status.\n";
+
+    Connection listener;
+    listener.listener = true;
+    listener.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    int reuse = 1;
+    setsockopt(listener.fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if(listener.fd < 0 || bind(listener.fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+       listen(listener.fd, SOMAXCONN) != 0)
+    {
+        std::cerr << "Unable to listen on the port " << port << ": " << std::strerror(errno) << "\n";
+        return 2;
+    }
+
+    // Timer przerwy (zbocze - jedno wybudzenie na przerwę)
+    Connection backoff;
+    backoff.fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    backoff.paused = &listener;
+    listener.backoff_fd = backoff.fd;
+    listener.spare_fd = open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event listener_event = {};
+    listener_event.events = EPOLLIN | EPOLLONESHOT;
+    listener_event.data.ptr = &listener;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listener.fd, &listener_event);
+
+    epoll_event backoff_event = {};
+    backoff_event.events = EPOLLIN | EPOLLET;
+    backoff_event.data.ptr = &backoff;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, backoff.fd, &backoff_event);
+
+    std::signal(SIGINT, stopService);
+    std::signal(SIGTERM, stopService);
+
+    threads_num = (threads_num == 0) ? 1 : threads_num;
+
+    std::mutex connections_lock;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::vector<std::thread> threads;
+
+    for(unsigned t = 0; t < threads_num; ++t)
+        threads.emplace_back(serveLoop, epoll_fd, std::ref(service), std::ref(connections_lock), std::ref(connections));
+
+    std::cout << "Sizing service on http://127.0.0.1:" << port << " (" << threads_num << " threads)" << std::endl;
+
+    for(std::thread & thread : threads)
+        thread.join();
+
+    for(auto & connection : connections)
+        close(connection.first);
+
+    close(epoll_fd);
+    close(listener.fd);
+    close(backoff.fd);
+
+    if(listener.spare_fd >= 0)
+        close(listener.spare_fd);
+
+    std::string stats;
+    service.answerStats(stats);
+    std::cout << "Stopped, counters: " << stats << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*!
+ * \file
+ * \brief JavaScript entry point of the generator (WebAssembly, embind)
+ *
+ * Exports the sizing algorithm to the host page without the widgets
+ * of the application (no QApplication, no MainWindow, no resources),
+ * so the page can size the covers directly:
+ *
+ *   const hp = await HPSizing();
+ *   hp.init();
+ *   const result = hp.size({ device: [800, 400, 900], spaces: [null, 50, null, null] });
+ *
+ * init uses the catalog compiled into the module (EmbeddedCatalog),
+ * initCatalog loads the text of the parameters file given by the page.
+ * Quote has the same arrays as the JSON sizing service, missing arrays
+ * and null values mean the data not given. Result has the status (name
+ * of GenErrors), the message (if loaded by setMessages), the inner and
+ * outer dimensions and the number of the wall modules.
+ */
+
+#include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include <memory>
+#include <string>
+#include "BulkSizer.hpp"
+#include "CoverSizer.hpp"
+#include "EmbeddedCatalog.hpp"
+#include "SizingMessages.hpp"
+
+using emscripten::val;
+
+/*!
+ * \brief Largest value accepted by the GUI (DimInput)
+ */
+static constexpr int MaxDimension = 2000;
+/*!
+ * \brief Status of the quote, which could not be read
+ */
+static constexpr char const *InvalidInput = "INVALID_INPUT";
+/*!
+ * \brief Status of the quote sized before the catalog has been loaded
+ */
+static constexpr char const *NoCatalog = "NO_CATALOG";
+
+/*!
+ * \brief Generator of the module with its catalog and messages
+ */
+struct WasmEngine
+{
+    /*! Parts library of the generator */
+    CatalogPtr catalog;
+    /*! Generator (empty before the catalog is loaded) */
+    std::unique_ptr<CoverSizer> sizer;
+    /*! Messages of the errors (the same as in the GUI) */
+    SizingMessages messages;
+};
+
+/*!
+ * \brief Return the generator of the module
+ */
+static WasmEngine & returnEngine()
+{
+    static WasmEngine engine;
+
+    return engine;
+}
+/*!
+ * \brief Set the catalog of the generator
+ */
+static bool setCatalog(CatalogPtr catalog)
+{
+    if(!catalog)
+        return false;
+
+    WasmEngine & engine = returnEngine();
+    engine.catalog = catalog;
+    engine.sizer = std::make_unique<CoverSizer>(catalog);
+
+    return true;
+}
+/*!
+ * \brief Load the catalog compiled into the module (no I/O, no parsing)
+ */
+static bool init()
+{
+    return setCatalog(EmbeddedCatalog::load());
+}
+/*!
+ * \brief Load the catalog from the text of the parameters file
+ */
+static bool initCatalog(const std::string & contents)
+{
+    return setCatalog(CoverCatalog::loadShared(contents));
+}
+/*!
+ * \brief Load the error messages from the text of the messages file
+ */
+static bool setMessages(const std::string & contents)
+{
+    return returnEngine().messages.readMessages(contents);
+}
+/*!
+ * \brief Read the array of the quote (null, undefined or -1 means the data not given)
+ */
+static bool readValues(const val & quote, const char *key, int *values, int values_num, bool required)
+{
+    val array = quote[key];
+
+    for(int v = 0; v < values_num; ++v)
+        values[v] = -1;
+
+    if(array.isUndefined() || array.isNull())
+        return !required;
+
+    if(!array.isArray() || array["length"].as<int>() != values_num)
+        return false;
+
+    for(int v = 0; v < values_num; ++v)
+    {
+        val value = array[v];
+
+        if(value.isUndefined() || value.isNull())
+            continue;
+
+        if(!value.isNumber())
+            return false;
+
+        double number = value.as<double>();
+
+        // Tylko liczby całkowite z zakresu DimInput (zakres przed rzutowaniem, również NaN)
+        if(!(number >= -1 && number < MaxDimension) || number != static_cast<int>(number))
+            return false;
+
+        values[v] = static_cast<int>(number);
+    }
+
+    return true;
+}
+/*!
+ * \brief Return the array of the dimensions as the JavaScript array
+ */
+static val returnArray(const uint16_t dims[DimNum])
+{
+    val array = val::array();
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+        array.call<void>("push", dims[d]);
+
+    return array;
+}
+/*!
+ * \brief Size the cover for the given quote
+ */
+static val size(const val & quote)
+{
+    WasmEngine & engine = returnEngine();
+    val answer = val::object();
+
+    // Bez jawnej inicjalizacji - katalog wkompilowany
+    if(!engine.sizer && !init())
+    {
+        answer.set("status", NoCatalog);
+        return answer;
+    }
+
+    SizingInput input;
+
+    if(!quote.isObject() || !readValues(quote, "device", input.device, DimNum, true) ||
+       !readValues(quote, "obstacles", input.obstacles, DimNum, false) ||
+       !readValues(quote, "spaces", input.spaces, DevSides, false))
+    {
+        answer.set("status", InvalidInput);
+        return answer;
+    }
+
+    for(uint8_t d = 0; d < DimNum; ++d)
+    {
+        if(input.device[d] < 0)
+        {
+            answer.set("status", InvalidInput);
+            return answer;
+        }
+    }
+
+    SizingResult result;
+    engine.sizer->generateCover(input, result);
+
+    answer.set("status", BulkSizer::statusName(result.error));
+
+    const std::string & message = engine.messages.returnMessage(result.error);
+
+    if(!message.empty())
+        answer.set("message", message);
+
+    if(result.error == GenErrors::COVER_OK)
+    {
+        answer.set("inner", returnArray(result.inner_dim));
+        answer.set("outer", returnArray(result.outer_dim));
+        answer.set("modules", result.modules);
+    }
+
+    return answer;
+}
+
+EMSCRIPTEN_BINDINGS(hpsizing)
+{
+    emscripten::function("init", &init);
+    emscripten::function("initCatalog", &initCatalog);
+    emscripten::function("setMessages", &setMessages);
+    emscripten::function("size", &size);
+}
@@ -11,6 +11,7 @@
  */
 
 #include <vector>
+#include "SizingTypes.hpp"
 #include "SummaryWindow.hpp"
 
 namespace fs = std::filesystem;
@@ -81,7 +82,7 @@ class CoverResultWindow : public SummaryWindow
         /*!
          * \brief Load the images for the appropriate size of the cover
          */
-        void getModulesQuantity(uint8_t modules_pcs);
+        void getCoverSize(COVER_SIZE size);
 
     public slots:
         /*!
@@ -130,6 +130,10 @@ class DataWindow : public FramedWidget
          * \return Reference to the dynamic 2D array with the user data
          */
         std::vector<std::vector<int>> & returnDimensions() { return dimensions; }
+        /*!
+         * \brief Return the saved dimensions with the values typed in the current step
+         */
+        std::vector<std::vector<int>> returnLiveDimensions();
 
     public slots:
         /*!
@@ -154,6 +158,10 @@ class DataWindow : public FramedWidget
          * \brief Signal sent, when all inputs are disabled
          */
         void noInputsGiven();
+        /*!
+         * \brief Signal sent after every check of the inputs (live preview)
+         */
+        void dataUpdated();
 };
 
 #endif // DATAWINDOW_HPP
@@ -70,6 +70,13 @@ class DimInput : public QWidget
          */
         GeneratorError data_error;
 
+        // Const attributes =========================================
+
+        /*!
+         * \brief Upper limit of the dimension (exclusive)
+         */
+        static constexpr int MaxDimension = 2000;
+
         // Protected methods ========================================
 
         /*!
@@ -110,6 +117,10 @@ class DimInput : public QWidget
          * \brief Returns the stored dimension
          */
         int returnData();
+        /*!
+         * \brief Returns the dimension currently typed in the field (live preview)
+         */
+        int returnLiveData();
         /*!
          * \brief Resets the input field
          */
@@ -16,21 +16,9 @@
 #include <QTextStream>
 #include <vector>
 #include <iostream>
+#include "RelaxationSearch.hpp"
+#include "SizingTypes.hpp"
 
-/*!
- * \brief Errors of the generator
- */
-enum GenErrors
-{
-    LEFT_COLLISION,  /*! Collision with the obstacle on the left */
-    RIGHT_COLLISION, /*! Collision with the obstacle on the right */
-    BACK_COLLISION,  /*! Collision with hthe obstacle on the back */
-    TOO_LONG,        /*! Desired cover is too wide */
-    TOO_WIDE,        /*! Desired cover is too deep */
-    TOO_HIGH,        /*! Desired cover is too high */
-    NO_PART_WIDTH,   /*! No part for the desired depth */
-    NO_PART_LENGTH   /*! No part for the desired width */
-};
 /*!
  * \brief Errors of the input data
  */
@@ -40,6 +28,17 @@ enum InputErrors
     TOO_HIGH_VALUE, /*! Too high value of the data */
     WRONG_VALUE     /*! Wrong value of the data (negative number) */
 };
+/*!
+ * \brief Lines of the suggestions file (names of SOFT_INPUT follow the last one)
+ */
+enum SuggestionLines
+{
+    SUGGESTION_TITLE,  /*! First line of the suggestions */
+    SUGGESTION_CHANGE, /*! Change of one value (name, from, to, direction, difference) */
+    SUGGESTION_LESS,   /*! Direction of the decreased value */
+    SUGGESTION_MORE,   /*! Direction of the increased value */
+    SUGGESTION_NAMES   /*! Name of the first soft input data */
+};
 
 /*!
  * \brief Class that implements the basic error handling
@@ -69,13 +68,13 @@ class GeneratorError
          * \brief Array with the input data error messages
          */
         std::vector<QString> input_error_msgs;
+        /*!
+         * \brief Array with the lines of the suggested changes
+         */
+        std::vector<QString> suggestion_msgs;
 
         // Const attributes =========================================
 
-        /*!
-         * \brief Number of possible errors of the generator
-         */
-        static constexpr int GenErrorsNum = 8;
         /*!
          * \brief Number of possible errors of the input data
          */
@@ -88,13 +87,21 @@ class GeneratorError
          * \brief Path to the error messages of the input data
          */
         static constexpr char const *UserInputErrorsPath = ":/errors/txt/InputErrorMsgs.txt";
+        /*!
+         * \brief Number of the lines of the suggested changes
+         */
+        static constexpr int SuggestionsNum = SUGGESTION_NAMES + SoftInputsNum;
+        /*!
+         * \brief Path to the lines of the suggested changes
+         */
+        static constexpr char const *SuggestionsPath = ":/errors/txt/SuggestionMsgs.txt";
 
         // Private methods ==========================================
 
         /*!
          * \brief Read and load the error messages form the given file
          */
-        bool readMessages(const char *path, std::vector<QString> & messages, int msg_num);
+        bool readMessages(const char *path, std::vector<QString> & messages, int msg_num, bool separated = true);
 
     public:
         /*!
@@ -109,6 +116,14 @@ class GeneratorError
          * \brief Set the current error of the input data
          */
         void raise(InputErrors error);
+        /*!
+         * \brief Add the suggestion of the change to the message of the current error
+         */
+        void addSuggestion(const QString & suggestion);
+        /*!
+         * \brief Add the suggested changes of the data to the message of the current error
+         */
+        void addSuggestions(const RelaxationResult & relaxation);
         /*!
          * \brief Return the message of the current error
          *
@@ -11,79 +11,33 @@
  * modules, collisions, errors).
  */
 
-#include <cmath>
-#include <sstream>
+#include <QCoreApplication>
 #include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <memory>
+#include "CatalogBlob.hpp"
+#include "CatalogWatcher.hpp"
+#include "CoverCache.hpp"
+#include "EmbeddedCatalog.hpp"
+#include "LatencyMeter.hpp"
+#include "ProductFamilies.hpp"
+#include "RelaxationSearch.hpp"
 #include "GeneratorError.hpp"
 
-/*!
- * \brief Number of considered sides of the heat pump
- */
-static constexpr uint8_t DevSides = 4;
-/*!
- * \brief Number of considered dimensions
- */
-static constexpr uint8_t DimNum = 3;
-/*!
- * \brief Structure with the names of all parameters
- *
- * Names of the parameters corresponds to the configuration
- * file. Thus, those strings are used to parse the custom
- * config and correctly distribute the values inside the
- * HPCover object.
- */
-struct VariableNames
-{
-    /*! Possible widths of the cover */
-    std::string BASE_LENGTH = "lengths";
-    /*! Possible depths of the cover */
-    std::string BASE_WIDTH = "widths";
-    /*! Heights of the modules (base, standard and top) */
-    std::string BASE_HEIGHT = "heights";
-    /*! Width correction value, which converts inner width to outer width */
-    std::string OUT_LENGTH = "out_length_param";
-    /*! Depth correction value, which converts inner depth to outer depth */
-    std::string OUT_WIDTH = "out_width_param";
-    /*! Height correction value, which converts inner height to outer height */
-    std::string OUT_HEIGHT = "out_height_param";
-    /*! Width correction value, which converts approx inner width to the accurate one */
-    std::string ACC_LENGTH = "acc_length_param";
-    /*! Depth correction value, which converts approx inner depth to the accurate one */
-    std::string ACC_WIDTH = "acc_width_param";
-    /*! Height correction value, which converts approx inner height to the accurate one */
-    std::string ACC_HEIGHT= "acc_height_param";
-    /*! Minimum space between inner surface of the cover and front of the device */
-    std::string FRONT_SPACE = "front_space";
-    /*! Minimum space between inner surface of the cover and sides of the device */
-    std::string SIDE_SPACE = "side_space";
-    /*! Minimum space between inner surface of the cover and back of the device */
-    std::string BACK_SPACE = "back_space";
-    /*! Minimum space between inner surface of the cover and top of the device */
-    std::string TOP_SPACE = "top_space";
-    /*! Minimum distance to the wall behind the device, for which cover should be standard */
-    std::string WALL_SPACE = "wall_space";
-};
-/*!
- * \brief Identification of the dimension in the arrays
- */
-enum DIM_ID
-{
-    LENGTH, /*! Width */
-    WIDTH,  /*! Depth */
-    HEIGHT  /*! Height */
-};
-
 /*!
  * \brief Class that implements the virtual sHP cover
  *
  * HPCover class is responsible for generating the
  * cover based on the provided data from the user.
- * It decides about success or failure (standard or
- * special cover) using the parameters from the custom
- * configuration file (available parts) and checking the
- * collisions with the nearby obstacles. It is implemented
- * in a way, which allows for the recaluclation of the
- * cover.
+ * It loads the custom configuration file (available
+ * parts) from the Qt resources and passes it to the
+ * Qt-free CoverSizer (shared catalog, results cached for
+ * the repeated inputs), which decides about success or
+ * failure (standard or special cover). HPCover converts
+ * the results and errors to the form used by the GUI.
+ * It is implemented in a way, which allows for the
+ * recaluclation of the cover.
  */
 class HPCover
 {
@@ -91,6 +45,14 @@ class HPCover
 
         // Functional members =======================================
 
+        /*!
+         * \brief Qt-free implementation of the sizing algorithm (with the cache of results)
+         */
+        CoverCache sizer;
+        /*!
+         * \brief Results of the last generation
+         */
+        SizingResult result;
         /*!
          * \brief Dynamic 2D array with the data from the user
          */
@@ -103,96 +65,89 @@ class HPCover
          * \brief Outer dimensions of the generated cover
          */
         std::vector<uint16_t> outer_dimensions;
-        /*!
-         * \brief Minimal necessary inner dimensions of the cover
-         */
-        std::vector<uint16_t> approx_inner_dim;
-        /*!
-         * \brief Number of wall modules (size of the standard cover)
-         */
-        uint8_t modules = 0;
         /*!
          * \brief Handler of the generator errors
          */
         GeneratorError error_handler;
         /*!
-         * \brief Base dimensions available in the parts library
+         * \brief Durations of the preview generations
          */
-        std::vector<float> base_dimensions[DimNum];
+        LatencyMeter preview_latency;
         /*!
-         * \brief Corrections used to caclulate the preceise inner dimensions
+         * \brief Values of the last preview (only the changed data is computed again)
          */
-        float acc_in_dimensions[DimNum];
+        SizingState preview_state;
         /*!
-         * \brief Corrections used to caclulate the preceise outer dimensions
+         * \brief Watcher of the parameters file next to the executable (hot reload)
          */
-        float acc_out_dimensions[DimNum];
+        std::unique_ptr<CatalogWatcher> catalog_watcher;
         /*!
-         * \brief Required minimal spaces inside the cover
+         * \brief Version of the watched catalog used by the generator
          */
-        float inner_offsets[DevSides];
+        uint64_t catalog_version = 0;
         /*!
-         * \brief Minimal distance to the wall behind for the standard cover
+         * \brief Generators of all product lines (the main one first)
          */
-        float wall_offset = 0;
+        ProductFamilies families;
 
         // Const attributes =========================================
 
         /*!
-         * \brief Constant structure with the names of the config parameters
+         * \brief Path to the custom configuration file
          */
-        const VariableNames params;
+        static constexpr char const *GenConfigPath = ":/cover_params/txt/CoverParameters.txt";
         /*!
-         * \brief Maximum number of standard modules (max height)
+         * \brief Name of the compiled configuration file (next to the executable)
          */
-        static constexpr uint8_t MaxWallModules = 3;
+        static constexpr char const *CompiledConfigName = "CoverParameters.hpcb";
         /*!
-         * \brief Path to the custom configuration file
+         * \brief Name of the watched configuration file (next to the executable)
          */
-        static constexpr char const *GenConfigPath = ":/cover_params/txt/CoverParameters.txt";
-
-        // Private methods ==========================================
-
+        static constexpr char const *WatchedConfigName = "CoverParameters.txt";
         /*!
-         * \brief Read and analyze the line of the file
+         * \brief Name of the folder with the parameters of the other product lines (next to the executable)
          */
-        bool readLine(std::stringstream & stream);
+        static constexpr char const *FamiliesDirName = "families";
         /*!
-         * \brief Calculate the required width
+         * \brief Name of the main product line
          */
-        bool countInnerLength();
+        static constexpr char const *MainFamilyName = "s|HP|";
         /*!
-         * \brief Calculate the required depth
+         * \brief Latency budget of the preview generation in nanoseconds
          */
-        bool countInnerWidth();
+        static constexpr uint64_t PreviewBudget = 1000000;
+
+        // Private methods ==========================================
+
         /*!
-         * \brief Calculate the required height
+         * \brief Read parameters of the generator from the compiled configuration file
          */
-        bool countInnerHeight();
+        CatalogPtr readCompiledParameters();
         /*!
-         * \brief Calculate the precise outer dimensions of the generated cover
+         * \brief Read parameters of the generator from the configuration file in the resources
          */
-        void countOuterDimensions();
+        CatalogPtr readResourceParameters();
         /*!
-         * \brief Check if there is a collision with the object on the left or right
+         * \brief Read parameters of the other product lines
          */
-        bool checkForLengthCollision(int constraint);
+        void readFamilies();
         /*!
-         * \brief Check if there is a collision with the object behind the device
+         * \brief Use the catalog as the main parts library
          */
-        bool checkForWidthCollision(int constraint);
+        void useCatalog(CatalogPtr parts);
         /*!
-         * \brief Find the base dimension available for the approximated one
+         * \brief Take the catalog published by the watcher (if changed)
          */
-        float pickRightDimension(DIM_ID dim_idx);
+        void refreshCatalog();
         /*!
-         * \brief Choose the appropriate number of the wall modules to the required height
+         * \brief Add the smallest changes of the data giving the standard cover to the error message
          */
-        uint8_t pickRightModulesQuantity();
+        void suggestChanges();
+
         /*!
-         * \brief Check if the required dimensions can be provided by the available parts
+         * \brief Convert the data from the user to the input of the sizing core
          */
-        bool searchPartsLibrary();
+        static SizingInput convertInputs(const std::vector<std::vector<int>> & dimensions);
 
     public:
         /*!
@@ -203,6 +158,14 @@ class HPCover
          * \brief Generate the cover
          */
         bool generateCover(std::vector<std::vector<int>> dimensions);
+        /*!
+         * \brief Generate the preview of the cover (stored results are not changed)
+         */
+        bool previewCover(const std::vector<std::vector<int>> & dimensions, SizingResult & preview);
+        /*!
+         * \brief Generate the cover of every product line (stored results are not changed)
+         */
+        size_t generateFamilies(const std::vector<std::vector<int>> & dimensions, std::vector<SizingResult> & results);
         /*!
          * \brief Display the loaded configuration parameters (debug only)
          */
@@ -228,7 +191,23 @@ class HPCover
          *
          * \return Total number of the wall modules
          */
-        uint8_t returnModulesQuantity() { return this->modules; }
+        uint8_t returnModulesQuantity() { return this->result.modules; }
+        /*!
+         * \brief Return the size of the generated cover (S, M, L, XL)
+         *
+         * \return Size of the cover
+         */
+        COVER_SIZE returnCoverSize() { return findCoverSize(this->result); }
+        /*!
+         * \brief Find the size of the cover from the height of its stack of the modules
+         *
+         * \param[in] generated - results of the generator (standard cover)
+         * \return Size of the cover
+         */
+        COVER_SIZE findCoverSize(const SizingResult & generated) const
+        {
+            return sizer.returnSizer().returnCatalog().returnIndex().findCoverSize(generated.inner_dim[DIM_ID::HEIGHT]);
+        }
         /*!
          * \brief Return currently stored user data
          */
@@ -239,6 +218,30 @@ class HPCover
          * \return Reference to the object with possibly raised error
          */
         GeneratorError & returnErrorHandler() { return this->error_handler; }
+        /*!
+         * \brief Return the cache of the generator results (hit / miss counters)
+         *
+         * \return Constant reference to the cache
+         */
+        const CoverCache & returnCache() const { return this->sizer; }
+        /*!
+         * \brief Return generators of all product lines
+         *
+         * \return Constant reference to the families
+         */
+        const ProductFamilies & returnFamilies() const { return this->families; }
+        /*!
+         * \brief Return durations of the preview generations
+         *
+         * \return Constant reference to the latency meter
+         */
+        const LatencyMeter & returnPreviewLatency() const { return this->preview_latency; }
+        /*!
+         * \brief Return number of the previews above the latency budget
+         *
+         * \return Number of the previews
+         */
+        uint64_t returnOverBudget() const { return this->preview_latency.returnOverBudget(); }
 };
 
 #endif // HPCOVER_HPP
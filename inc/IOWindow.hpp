@@ -102,6 +102,13 @@ class IOWindow : public QWidget
          * \return Numerical value stored in the data field (-1 in case of the status different than correct)
          */
         int returnDataFrom(int index) { return this->data_input[index]->returnData(); }
+        /*!
+         * \brief Return the numeric data currently typed in the given input
+         *
+         * \param[in] index - index of the data field on the list
+         * \return Numerical value typed in the data field (-1 if empty, wrong or disabled)
+         */
+        int returnLiveDataFrom(int index) { return this->data_input[index]->returnLiveData(); }
         /*!
          * \brief Check if all data inputs contain correct values
          */
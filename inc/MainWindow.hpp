@@ -12,6 +12,7 @@
 
 #include <QMainWindow>
 #include <QStatusBar>
+#include <QTimer>
 #include "DataWindow.hpp"
 #include "ImagesViewer.hpp"
 #include "Terminal.hpp"
@@ -21,6 +22,7 @@
 #include "StartWindow.hpp"
 #include "ContactWindow.hpp"
 #include "Statistics.hpp"
+#include "PreviewPanel.hpp"
 
 /*!
  * \def MSG_NUM
@@ -116,6 +118,14 @@ class MainWindow : public QMainWindow
          * \brief Widget with the inputs for the numeric data of the generator
          */
         DataWindow *input_dim;
+        /*!
+         * \brief Live preview of the cover for the data typed so far
+         */
+        PreviewPanel *preview;
+        /*!
+         * \brief Joins all changes of the data from one pass of the event loop into one preview
+         */
+        QTimer *preview_timer;
         /*!
          * \brief Switches to the next part of the app
          */
@@ -256,6 +266,14 @@ class MainWindow : public QMainWindow
          * \brief Change the appearance of the window for the previous generator step
          */
         void goToPreviousStep();
+        /*!
+         * \brief Request the update of the live preview
+         */
+        void schedulePreview();
+        /*!
+         * \brief Generate the cover from the data typed so far and display it in the preview
+         */
+        void updatePreview();
         /*!
          * \brief Go back to the generator part of the application
          */
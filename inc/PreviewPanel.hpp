@@ -0,0 +1,102 @@
+#ifndef PREVIEWPANEL_HPP
+#define PREVIEWPANEL_HPP
+
+/*!
+ * \file
+ * \brief Definition of the class PreviewPanel
+ *
+ * This file contains definition of the class PreviewPanel,
+ * which displays the compact result of the generator while
+ * the user is still typing the input data.
+ */
+
+#include "FramedWidget.hpp"
+#include "GeneratorError.hpp"
+#include "LatencyMeter.hpp"
+#include "ProductFamilies.hpp"
+
+/*!
+ * \brief Class that implements the live preview of the cover
+ *
+ * PreviewPanel inherits from the FramedWidget, so it is visible
+ * in the main window with the title and frame. It shows the outer
+ * dimensions and number of modules of the cover generated from the
+ * current (possibly incomplete) input data, or the reason why the
+ * standard cover cannot be made. Results of the other product lines
+ * (if any) are listed below. Last line shows the duration of
+ * the last generation and its 99th percentile.
+ */
+class PreviewPanel : public FramedWidget
+{
+    Q_OBJECT
+    private:
+
+        // Functional members =======================================
+
+        /*!
+         * \brief Compact result of the generator
+         */
+        QLabel *summary;
+        /*!
+         * \brief Results of the other product lines (hidden if there is only one)
+         */
+        QLabel *families_summary;
+        /*!
+         * \brief Duration of the generator
+         */
+        QLabel *latency;
+        /*!
+         * \brief Messages of the generator errors
+         */
+        GeneratorError error_msgs;
+
+        // Const attributes =========================================
+
+        /*!
+         * \brief Maximum height of the panel
+         */
+        static constexpr int PanelMaxHeight = 95;
+        /*!
+         * \brief Height of one line of the product lines summary
+         */
+        static constexpr int FamilyLineHeight = 16;
+        /*!
+         * \brief Names of the sizes of the cover (order of COVER_SIZE)
+         */
+        static constexpr char const *CoverSizeNames[CoverSizesNum] = { "S", "M", "L", "XL" };
+
+        // Private methods ==========================================
+
+        /*!
+         * \brief Set the settings and graphics of the inner widgets
+         */
+        void setStoredWidgets();
+        /*!
+         * \brief Align the title of the window with the stored widgets vertically
+         */
+        void setVerticalLayout();
+
+    public:
+        /*!
+         * \brief Initialization of the class PreviewPanel
+         */
+        PreviewPanel(const char *widget_title, QWidget *parent = nullptr);
+        /*!
+         * \brief Display the result of the generator
+         */
+        void showResult(const SizingResult & result, COVER_SIZE size);
+        /*!
+         * \brief Display the information about the missing dimensions of the device
+         */
+        void showMissingData();
+        /*!
+         * \brief Display the results of all product lines
+         */
+        void showFamilies(const ProductFamilies & families, const std::vector<SizingResult> & results);
+        /*!
+         * \brief Display the duration of the generator
+         */
+        void showLatency(const LatencyMeter & meter);
+};
+
+#endif // PREVIEWPANEL_HPP
@@ -59,22 +59,29 @@ void CoverResultWindow::setWidgetsLayout()
  * \brief Load the images for the appropriate size of the cover
  *
  * Load the images prepared for the result window according
- * to the number of the wall modules. Number of modules determine
- * the size of the cover (S, M, L or XL) and so the path to the
- * correct images.
+ * to the size of the cover (S, M, L or XL), which is determined
+ * by the height of the stack of the wall modules (see CatalogIndex),
+ * and so the path to the correct images.
  *
- * \param[in] modules_pcs - number of modules
+ * \param[in] size - size of the cover
  */
-void CoverResultWindow::getModulesQuantity(uint8_t modules_pcs)
+void CoverResultWindow::getCoverSize(COVER_SIZE size)
 {
-    if(modules_pcs == 0)
-        images->loadResultImages(S_Size);
-    else if(modules_pcs == 2)
-        images->loadResultImages(M_Size);
-    else if(modules_pcs == 4)
-        images->loadResultImages(L_Size);
-    else if(modules_pcs == 6)
-        images->loadResultImages(XL_Size);
+    switch(size)
+    {
+        case SIZE_S:
+            images->loadResultImages(S_Size);
+            break;
+        case SIZE_M:
+            images->loadResultImages(M_Size);
+            break;
+        case SIZE_L:
+            images->loadResultImages(L_Size);
+            break;
+        case SIZE_XL:
+            images->loadResultImages(XL_Size);
+            break;
+    }
 }
 /*!
  * \brief Get the output dimensions from the generator (results)
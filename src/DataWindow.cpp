@@ -96,7 +96,8 @@ void DataWindow::setVerticalLayout()
  * methods of the active IOWindow and check the overall status
  * of the whole widget based on the separate states of the data
  * inputs. Notify the higher widget about the state of the data
- * window using appropriate signal.
+ * window using appropriate signal. At the end notify it that the
+ * values might have changed (live preview).
  */
 void DataWindow::checkAllInputs()
 {
@@ -112,6 +113,8 @@ void DataWindow::checkAllInputs()
         emit oneDataWrong(data_windows[curr_id]->retStatusMsg());
     else if(data_windows[curr_id]->oneInputEditing())
         emit oneDataEditing();
+
+    emit dataUpdated();
 }
 /*!
  * \brief Change the appearance of the window according to the current step
@@ -151,6 +154,31 @@ void DataWindow::saveData(Steps step)
     for(uint8_t i = 0; i < inputs_num; ++i)
         dimensions[step][i] = data_windows[curr_id]->returnDataFrom(i);
 }
+/*!
+ * \brief Return the saved dimensions with the values typed in the current step
+ *
+ * Copy the saved dimensions and overwrite the row of the current
+ * step with the values typed in the active IOWindow (also those,
+ * which are still edited). Missing values are -1. The saved data
+ * is not changed.
+ *
+ * \return Dynamic 2D array with the user data
+ */
+std::vector<std::vector<int>> DataWindow::returnLiveDimensions()
+{
+    std::vector<std::vector<int>> live_dimensions = dimensions;
+    int curr_id = steps_switcher->currentIndex();
+
+    if(curr_id == -1)
+        return live_dimensions;
+
+    uint8_t inputs_num = data_windows[curr_id]->retInputsNumber();
+
+    for(uint8_t i = 0; i < inputs_num; ++i)
+        live_dimensions[curr_id][i] = data_windows[curr_id]->returnLiveDataFrom(i);
+
+    return live_dimensions;
+}
 /*!
  * \brief Read the labels / titles from the given file to the desired buffer
  *
@@ -82,7 +82,7 @@ bool DimInput::checkNewData(QString new_data, uint16_t *correct_data)
         return false;
     }
 
-    if(numeric_dimension >= 2000)
+    if(numeric_dimension >= MaxDimension)
     {
         data_error.raise(InputErrors::TOO_HIGH_VALUE);
         return false;
@@ -213,3 +213,25 @@ int DimInput::returnData()
 
     return dimension;
 }
+/*!
+ * \brief Returns the dimension currently typed in the field (live preview)
+ *
+ * Convert the text of the field without changing the status or
+ * raising the errors, so the value can be used while the user is
+ * still typing. Disabled, empty or incorrect field gives -1.
+ *
+ * \return Typed dimension (integer) or -1
+ */
+int DimInput::returnLiveData()
+{
+    if(dim_status == DISABLED)
+        return -1;
+
+    bool convert_flag;
+    int numeric_dimension = input_dim->text().toInt(&convert_flag);
+
+    if(!convert_flag || numeric_dimension < 0 || numeric_dimension >= MaxDimension)
+        return -1;
+
+    return numeric_dimension;
+}
@@ -3,13 +3,15 @@
 /*!
  * \brief Initialization of the class GeneratorError
  *
- * Read the possible generator errors and possible numeric input
- * data errors from the text files to the given buffers.
+ * Read the possible generator errors, possible numeric input
+ * data errors and the lines of the suggested changes from the
+ * text files to the given buffers.
  */
 GeneratorError::GeneratorError()
 {
     readMessages(GenErrorsPath, gen_error_msgs, GenErrorsNum);
     readMessages(UserInputErrorsPath, input_error_msgs, UserInputErrorsNum);
+    readMessages(SuggestionsPath, suggestion_msgs, SuggestionsNum, false);
 }
 /*!
  * \brief Set the current error of the generator
@@ -29,6 +31,43 @@ void GeneratorError::raise(InputErrors error)
 {
     error_msg = input_error_msgs[error];
 }
+/*!
+ * \brief Add the suggestion of the change to the message of the current error
+ *
+ * \param[in] suggestion - one line of the suggestion (without the new line character)
+ */
+void GeneratorError::addSuggestion(const QString & suggestion)
+{
+    error_msg += suggestion + QString("\n");
+}
+/*!
+ * \brief Add the suggested changes of the data to the message of the current error
+ *
+ * Add the title and one line per changed value (name of the value,
+ * value given by the user, suggested value and the difference).
+ * Nothing is added, if the suggestions file has not been loaded.
+ *
+ * \param[in] relaxation - nearest data giving the standard cover
+ */
+void GeneratorError::addSuggestions(const RelaxationResult & relaxation)
+{
+    if(suggestion_msgs.size() != SuggestionsNum)
+        return;
+
+    addSuggestion(suggestion_msgs[SUGGESTION_TITLE]);
+
+    for(uint8_t i = 0; i < relaxation.changes_num; ++i)
+    {
+        const InputChange & change = relaxation.changes[i];
+
+        addSuggestion(suggestion_msgs[SUGGESTION_CHANGE]
+                      .arg(suggestion_msgs[SUGGESTION_NAMES + change.input])
+                      .arg(change.from)
+                      .arg(change.to)
+                      .arg(suggestion_msgs[(change.to < change.from) ? SUGGESTION_LESS : SUGGESTION_MORE])
+                      .arg(qAbs(change.to - change.from)));
+    }
+}
 /*!
  * \brief Read and load the error messages form the given file
  *
@@ -37,14 +76,15 @@ void GeneratorError::raise(InputErrors error)
  * and return false. Read the file line by line and assign each
  * of them as an element of the target array. Add additional
  * new line characters at the beginning and at the end of each
- * error message.
+ * error message, if the messages are separated.
  *
  * \param[in] path - path to the file
  * \param[in] messages - reference to the buffer for the messages
  * \param[in] msg_num - total number of messages
+ * \param[in] separated - true if the messages are surrounded by the empty lines
  * \return True if loaded and false otherwise
  */
-bool GeneratorError::readMessages(const char *path, std::vector<QString> & messages, int msg_num)
+bool GeneratorError::readMessages(const char *path, std::vector<QString> & messages, int msg_num, bool separated)
 {
     QFile msg_file(path);
 
@@ -63,7 +103,7 @@ bool GeneratorError::readMessages(const char *path, std::vector<QString> & messa
 
         if(!qt_line.isEmpty() && i < msg_num)
         {
-            messages.push_back(QString("\n") + qt_line + QString("\n"));
+            messages.push_back(separated ? QString("\n") + qt_line + QString("\n") : qt_line);
             ++i;
         }
     }
@@ -3,35 +3,59 @@
 /*!
  * \brief Initialization of the class HPCover
  *
- * Fill the stored arrays with zeros - dynamic arrays in the
- * initialization list and static arrays using for loops.
+ * Fill the stored dynamic arrays with zeros in the
+ * initialization list. If the default catalog is compiled
+ * into the program (e.g. WASM build), the generator gets it
+ * at once, without reading any file. Outside the browser, the
+ * parameters file next to the executable is watched, so the
+ * changed catalog is used without restarting the program.
  */
 HPCover::HPCover() : inner_dimensions(DimNum, 0),
                      outer_dimensions(DimNum, 0),
-                     approx_inner_dim(DimNum, 0)
+                     preview_latency(PreviewBudget)
 {
+    if(EmbeddedCatalog::isAvailable())
+        useCatalog(EmbeddedCatalog::load());
+
+#ifndef Q_OS_WASM
+    QString watched_path = QCoreApplication::applicationDirPath() + "/" + WatchedConfigName;
+
+    catalog_watcher = std::make_unique<CatalogWatcher>(watched_path.toStdString());
+    catalog_watcher->start();
+#endif
+}
+/*!
+ * \brief Convert the data from the user to the input of the sizing core
+ *
+ * \param[in] dimensions - input data from the user (3 rows)
+ * \return Input data of the sizing core
+ */
+SizingInput HPCover::convertInputs(const std::vector<std::vector<int>> & dimensions)
+{
+    SizingInput input;
+
     for(uint8_t i = 0; i < DimNum; ++i)
     {
-        acc_in_dimensions[i] = 0;
-        acc_out_dimensions[i] = 0;
+        input.device[i] = dimensions[0][i];
+        input.obstacles[i] = dimensions[1][i];
     }
 
     for(uint8_t i = 0; i < DevSides; ++i)
-        inner_offsets[i] = 0;
+        input.spaces[i] = dimensions[2][i];
+
+    return input;
 }
 /*!
  * \brief Generate the cover
  *
- * Overwrite the stored inputs from the user with the new ones.
- * Sort the dimensions of the base parts of the cover (from the
- * configuration file) in order to make sure that they can be
- * correctly found later. Then count all inner dimensions and
- * check if they exceed the limits. If not, iterate through the
- * available parts and find the ones that match to the calculated
- * inner dimensions. If parts have been found, determine the exact
- * inner and outer dimensions of the cover. If the cover has been
- * correctly generated, determine the collisions with the nearby
- * obstacles (if present).
+ * Overwrite the stored inputs from the user with the new ones and
+ * convert them to the structure used by the sizing core. Generate
+ * the cover using CoverSizer (or take the result of the same input
+ * from the cache) and copy back the input data with the
+ * resolved default spaces, so they can be displayed in the results.
+ * If generator failed, raise the appropriate error in the handler
+ * together with the suggested changes of the data. Otherwise, store
+ * the inner and outer dimensions of the cover.
  *
  * \param[in] dimensions - input data from the user
  * \return True if generated, false if not
@@ -41,472 +65,278 @@ bool HPCover::generateCover(std::vector<std::vector<int>> dimensions)
     // Nadpisanie macierzy danych wejściowych (możliwość aktualizowania wyników)
     dim_matrix = dimensions;
 
-    // Sortowanie wczytanych dostępnych wymiarów (dla pewności)
-    for(uint8_t i = 0; i < DimNum; ++i)
-        std::sort(base_dimensions[i].begin(), base_dimensions[i].end());
-
-    // Obliczenia wszystkich POTRZEBNYCH wymiarów wewnętrznych
-    bool length_correct = countInnerLength();
-    bool width_correct = countInnerWidth();
-    bool height_correct = countInnerHeight();
-
-    if(!length_correct)
-        error_handler.raise(GenErrors::TOO_LONG);
-    else if(!width_correct)
-        error_handler.raise(GenErrors::TOO_WIDE);
-    else if(!height_correct)
-        error_handler.raise(GenErrors::TOO_HIGH);
+    refreshCatalog();
+    bool generated = sizer.generateCover(convertInputs(dim_matrix), result);
+    // Odstępy z uzupełnionymi wartościami domyślnymi
+    for(uint8_t i = 0; i < DevSides; ++i)
+        dim_matrix[2][i] = result.input.spaces[i];
 
-    if(!(length_correct & width_correct & height_correct))
-        return false;
-    // Przeszukanie bilbioteki części
-    if(!searchPartsLibrary())
-        return false;
-    // Obliczenie wymiarów zewnętrznych wygenerowanej obudowy
-    countOuterDimensions();
-
-    // Sprawdzenie kolizji z ewentualnymi przeszkodami
-    bool no_left_collision = checkForLengthCollision(dim_matrix[1][0]);
-    bool no_right_collision = checkForLengthCollision(dim_matrix[1][1]);
-    bool no_back_collision = checkForWidthCollision(dim_matrix[1][2]);
-
-    if(!no_left_collision)
-        this->error_handler.raise(GenErrors::LEFT_COLLISION);
-    else if(!no_right_collision)
-        this->error_handler.raise(GenErrors::RIGHT_COLLISION);
-    else if(!no_back_collision)
-        this->error_handler.raise(GenErrors::BACK_COLLISION);
-
-    if(!(no_left_collision & no_right_collision & no_back_collision))
+    if(!generated)
+    {
+        error_handler.raise(result.error);
+        suggestChanges();
         return false;
+    }
 
-    return true;
-}
-/*!
- * \brief Calculate the required width
- *
- * First, determine the maximum width of the cover based on the
- * available parts. Then, calculate the required width with addition
- * of the left and right inner spaces between cover and heat pump (from the user or
- * default if not given). Check if it exceeds the limit. If so, return
- * false (required cover is too wide).
- *
- * \return True when value is lower than the max threshold and false otherwise
- */
-bool HPCover::countInnerLength()
-{
-    int max_length = base_dimensions[0].back() + acc_in_dimensions[0];
-    // Dodanie domyślnej wartości odstępu od boków wewnątrz
-    // jeżeli użytkownik nie podał tej zmiennej (wpisane 0).
-    dim_matrix[2][0] = (dim_matrix[2][0] == -1) ? inner_offsets[1] : dim_matrix[2][0];
-
-    approx_inner_dim[0] = dim_matrix[0][0] + 2 * dim_matrix[2][0];
-
-    if(approx_inner_dim[0] > max_length)
-        return false;
+    for(uint8_t i = 0; i < DimNum; ++i)
+    {
+        inner_dimensions[i] = result.inner_dim[i];
+        outer_dimensions[i] = result.outer_dim[i];
+    }
 
     return true;
 }
 /*!
- * \brief Calculate the required depth
+ * \brief Generate the preview of the cover (stored results are not changed)
  *
- * First, determine the maximum depth of the cover based on the
- * available parts. Then, calculate the required depth with addition
- * of the front and back inner spaces between cover and heat pump (from the user or
- * default if not given). Check if it exceeds the limit. If so, return
- * false (required cover is too deep).
+ * Used by the live preview, which runs the generator after every
+ * change of the input data. Usually only one value is changed,
+ * so the generator works incrementally and computes again only
+ * the values depending on it. Results, errors and user data stored
+ * for the result windows are left untouched. If the centered cover
+ * hits the obstacle on the left or right, the preview shows the
+ * shift of the device inside the cover, which avoids it. If the
+ * standard cover cannot be generated anyway, the device rotated by
+ * 90 degrees is checked too (width and depth swapped). Duration
+ * of every call is measured and compared with the latency budget.
+ * Hints are only the extra passes, so they are skipped if the budget
+ * has already been used (the centered result is shown then).
  *
- * \return True when value is lower than the max threshold and false otherwise
+ * \param[in] dimensions - input data from the user (possibly incomplete)
+ * \param[out] preview - results of the generator
+ * \return True if generated, false if not
  */
-bool HPCover::countInnerWidth()
+bool HPCover::previewCover(const std::vector<std::vector<int>> & dimensions, SizingResult & preview)
 {
-    int max_width = base_dimensions[1].back() + acc_in_dimensions[1];
-    // Obliczenie wymiaru wewnętrznego i ustalenie typu obudowy
-    // zależnie od odległości z tyłu (do eleweacji).
-    dim_matrix[2][1] = (dim_matrix[2][1] == -1) ? inner_offsets[0] : dim_matrix[2][1];
-    dim_matrix[2][2] = (dim_matrix[2][2] == -1) ? inner_offsets[2] : dim_matrix[2][2];
+    refreshCatalog();
+    // Jeden generator dla wszystkich przebiegów podglądu
+    const CoverSizer generator = sizer.returnSizer();
 
-    approx_inner_dim[1] = dim_matrix[0][1] + dim_matrix[2][1] + dim_matrix[2][2];
+    auto start = std::chrono::steady_clock::now();
+    auto withinBudget = [&]()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - start).count()) < PreviewBudget;
+    };
 
-    if(approx_inner_dim[1] > max_width)
-        return false;
+    bool generated = generator.updateCover(convertInputs(dimensions), preview_state, preview);
+    // Kolizja z boku - podpowiedź przesunięcia urządzenia w obudowie
+    if(!generated && withinBudget())
+        generated = generator.placeOffCenter(preview);
+    // Obudowa specjalna - podpowiedź obrotu urządzenia
+    if(!generated && withinBudget())
+        generated = generator.exploreRotation(preview, true);
 
-    return true;
+    preview_latency.addSince(start);
+
+    return generated;
 }
 /*!
- * \brief Calculate the required height
+ * \brief Generate the cover of every product line (stored results are not changed)
  *
- * First, determine the maximum height of the cover based on the
- * available parts and maximum number of wall modules. Then, calculate
- * the required height with addition of the top inner space
- * between cover and heat pump (from the user or default if not given).
- * Check if it exceeds the limit. If so, return false (required cover is
- * too high).
+ * The same input data is sized with the catalog of every family,
+ * so it can be seen at once which product lines fit the device.
  *
- * \return True when value is lower than the max threshold and false otherwise
+ * \param[in] dimensions - input data from the user
+ * \param[out] results - results of the generator for each family
+ * \return Number of the families with the standard cover
  */
-bool HPCover::countInnerHeight()
+size_t HPCover::generateFamilies(const std::vector<std::vector<int>> & dimensions, std::vector<SizingResult> & results)
 {
-    int max_height = base_dimensions[2][0] + base_dimensions[2][2];
-    max_height += base_dimensions[2][1] * MaxWallModules;
+    refreshCatalog();
 
-    dim_matrix[2][3] = (dim_matrix[2][3] == -1) ? inner_offsets[3] : dim_matrix[2][3];
-
-    approx_inner_dim[2] = dim_matrix[0][2] + dim_matrix[2][3];
-
-    if(approx_inner_dim[2] > max_height)
-        return false;
-
-    return true;
+    return families.generateCovers(convertInputs(dimensions), results);
 }
 /*!
- * \brief Calculate the precise outer dimensions of the generated cover
+ * \brief Return currently stored user data
  *
- * Outer dimension is the addition of the inner dimension calculated
- * from the rounded parts dimensions and the precise values (corrections)
- * from the CAD program.
+ * \return Reference to the dynamic array with user input data
  */
-void HPCover::countOuterDimensions()
+std::vector<std::vector<int>> & HPCover::returnFinalDimensions()
 {
-    for(uint8_t i = 0; i < DimNum; ++i)
-        outer_dimensions[i] = inner_dimensions[i] + acc_out_dimensions[i];
+    return dim_matrix;
 }
 /*!
- * \brief Check if there is a collision with the object on the left or right
- *
- * If distance to the obstacle is not given (-1), return true (no collision).
- * Compare the half of the outer width of the cover with the distance to
- * the obstacle from the center of the heat pump (assuming that centers of the
- * cover and device will be aligned vertically.)
+ * \brief Display the loaded configuration parameters (debug only)
  *
- * \param[in] constraint - distance to the obstacle typed by the user
- * \return True for collision and false otherwise
+ * Print all the parameters loaded from the configuration file
+ * on the standard output, usually terminal. It is used to check
+ * if the configuration file has been correctly parsed. Counters
+ * of the cache show how often the same inputs are sized again,
+ * the number of the slow previews is printed too.
  */
-bool HPCover::checkForLengthCollision(int constraint)
+void HPCover::printResults()
 {
-    if(constraint == -1)
-        return true;
+    sizer.returnSizer().returnCatalog().printParameters();
 
-    int cover_outer_dim = outer_dimensions[0];
-    int dimension = dim_matrix[0][0];
-    int half_cover_dim = ceil(cover_outer_dim / 2);
-    int dist_to_obstacle = floor(dimension / 2) + constraint;
-
-    if(dist_to_obstacle <= half_cover_dim)
-        return false;
-
-    return true;
+    qDebug() << "Generator cache: hits" << sizer.returnHits() << "misses" << sizer.returnMisses();
+    qDebug() << "Previews above the latency budget:" << returnOverBudget() << "of" << preview_latency.returnCount();
 }
 /*!
- * \brief Check if there is a collision with the object behind the device
- *
- * If distance to the obstacle is not given (-1), return true (no collision).
- * Compare the half of the outer depth of the cover with the distance to
- * the obstacle from the center of the heat pump. Device and cover do not have
- * to be algined, the front and back inner spaces are taken into account.
+ * \brief Take the catalog published by the watcher (if changed)
  *
- * \param[in] constraint - distance to the obstacle typed by the user
- * \return True for collision and false otherwise
+ * Only the version is compared (no lock), the catalog is replaced
+ * after the change. Results cached for the old catalog are dropped
+ * and the preview computes everything again at the next request.
  */
-bool HPCover::checkForWidthCollision(int constraint)
+void HPCover::refreshCatalog()
 {
-    if(constraint == -1)
-        return true;
+    if(!catalog_watcher || catalog_watcher->returnVersion() == catalog_version)
+        return;
 
-    int cover_outer_dim = outer_dimensions[1];
-    int dimension = dim_matrix[0][1];
-    int dist_to_obstacle = floor(dimension / 2) + constraint;
+    catalog_version = catalog_watcher->returnVersion();
+    useCatalog(catalog_watcher->returnCatalog());
 
-    int offset = ceil(inner_dimensions[1] / 2) - ceil(dimension / 2) - dim_matrix[2][2];
-    int half_cover_dim = ceil(cover_outer_dim / 2) - offset;
-
-    if(dist_to_obstacle <= half_cover_dim)
-        return false;
-
-    return true;
-}
-/*!
- * \brief Return currently stored user data
- *
- * \return Reference to the dynamic array with user input data
- */
-std::vector<std::vector<int>> & HPCover::returnFinalDimensions()
-{
-    return dim_matrix;
+    qDebug() << "HP cover parameters reloaded (version" << catalog_version << ").";
 }
 /*!
- * \brief Check if the required dimensions can be provided by the available parts
+ * \brief Add the smallest changes of the data giving the standard cover to the error message
  *
- * Find the available width and depth of the cover for the required
- * inner dimensions (from the user). If returend value is -1, then it
- * means that the part has not been found and the appropriate error is
- * raised. If both width and depth are available, calculate how many wall
- * modules of the standard cover is necessary.
- *
- * \return True if standard cover can be made and false otherwise (too large)
+ * Search the nearest data, for which the standard cover can be
+ * generated (RelaxationSearch, only spaces and obstacles are changed),
+ * and add one line per changed value (texts from the resources, see
+ * GeneratorError). Nothing is added, if the device needs the special
+ * cover anyway.
  */
-bool HPCover::searchPartsLibrary()
+void HPCover::suggestChanges()
 {
-    // Znajdź pasującą długość i szerokość i zaktualizuj wymiary wewnętrzne
-    int available_length = static_cast<int>(pickRightDimension(DIM_ID::LENGTH));
-    int available_width = static_cast<int>(pickRightDimension(DIM_ID::WIDTH));
-    // Nie da się wygenerować obudowy standardowej
-    if(available_length == -1)
-    {
-        error_handler.raise(GenErrors::NO_PART_LENGTH);
-        return false;
-    }
-    if(available_width == -1)
-    {
-        error_handler.raise(GenErrors::NO_PART_WIDTH);
-        return false;
-    }
-    // Znajdź ilość potrzebnych modułów i zaktualizuj wysokość wewnętrzną
-    modules = pickRightModulesQuantity();
+    RelaxationResult relaxation;
 
-    return true;
+    if(!RelaxationSearch::findNearestFeasible(sizer.returnSizer(), convertInputs(dim_matrix), relaxation) ||
+       relaxation.changes_num == 0)
+        return;
+
+    error_handler.addSuggestions(relaxation);
 }
 /*!
- * \brief Find the base dimension available for the approximated one
+ * \brief Read parameters of the generator from the compiled configuration file
  *
- * Iterate over the list of available dimensions (given by the input
- * argument 'dim_idx') and find the first value that is greater than
- * or equal to dimension calculated from the input data provided by
- * the user. Available dimensions are sorted, thus there is no need
- * to iterate over the whole list each time. If the dim
+ * Map the compiled file into the memory and load the catalog directly
+ * from it (no text parsing). Damaged or outdated file is ignored.
  *
- * \param[in] dim_idx - required dimension (enumeration)
- * \return Found dimension from the list of available ones (parts of the cover)
+ * \return Shared pointer to the catalog or empty pointer if not available
  */
-float HPCover::pickRightDimension(DIM_ID dim_idx)
+CatalogPtr HPCover::readCompiledParameters()
 {
-    float found_dimension = -1;
+    QFile compiled_file(QCoreApplication::applicationDirPath() + "/" + CompiledConfigName);
 
-    // Znajdź pierwszy napotkany pasujący wymiar - długość lub szerokość
-    for(uint8_t j = 0; j < base_dimensions[dim_idx].size(); ++j)
-    {
-        // Dokładny dostępny wymiar
-        float acc_available_dim = base_dimensions[dim_idx][j] + acc_in_dimensions[dim_idx];
-        // Jeżeli dostępny wymiar jest większy lub równy niż wymagany to:
-        if(acc_available_dim >= approx_inner_dim[dim_idx])
-        {
-            found_dimension = base_dimensions[dim_idx][j];
-            break;
-        }
-    }
-    // Zapisanie oficjalnego wyniku
-    inner_dimensions[dim_idx] = found_dimension + acc_in_dimensions[dim_idx];
+    if(!compiled_file.exists() || !compiled_file.open(QIODevice::ReadOnly))
+        return nullptr;
 
-    return found_dimension;
-}
-/*!
- * \brief Choose the appropriate number of the wall modules to the required height
- *
- * Calculate the minimum height that is required by the user
- * and then increment the number of modules until the raising
- * height is greater than or equal to the minimum height.
- * At the end update the precise inner height of the cover.
- *
- * \return Total number of the wall modules (for both walls)
- */
-uint8_t HPCover::pickRightModulesQuantity()
-{
-    // Minimalna wysokośc obudowy (moduł dolny i górny z poprawką dokładności)
-    uint16_t sum_height = base_dimensions[DIM_ID::HEIGHT][0] +
-                          base_dimensions[DIM_ID::HEIGHT][2] +
-                          acc_in_dimensions[DIM_ID::HEIGHT];
+    uchar *mapped = compiled_file.map(0, compiled_file.size());
 
-    uint8_t std_modules_pcs = 0;
+    if(mapped == nullptr)
+        return nullptr;
 
-    while(true)
-    {
-        if(sum_height >= approx_inner_dim[DIM_ID::HEIGHT])
-            break;
+    CatalogPtr catalog = CatalogBlob::load(mapped, compiled_file.size());
+    compiled_file.unmap(mapped);
 
-        sum_height += base_dimensions[DIM_ID::HEIGHT][1];
-        ++std_modules_pcs;
-    }
-    // Zapisanie oficjalnego wyniku
-    inner_dimensions[DIM_ID::HEIGHT] = sum_height;
+    if(!catalog)
+        qDebug() << "Compiled HP cover parameters are not valid, resources are used instead.";
 
-    return std_modules_pcs * 2;
+    return catalog;
 }
 /*!
- * \brief Display the loaded configuration parameters (debug only)
+ * \brief Read parameters of the generator from the configuration file in the resources
  *
- * Print all the parameters loaded from the configuration file
- * on the standard output, usually terminal. It is used to check
- * if the configuration file has been correctly parsed.
+ * Open the configuration file from the resources and read its whole
+ * contents if opened without errors. Pass the raw bytes to the catalog
+ * of the sizing core, which interprets them in place and distribute
+ * the values to the correct buffers (errors are reported with the line
+ * and column).
+ *
+ * \return Shared pointer to the catalog or empty pointer if not loaded
  */
-void HPCover::printResults()
+CatalogPtr HPCover::readResourceParameters()
 {
-    std::cout << "\nBase dimensions: \n";
-    for(uint8_t i = 0; i < DimNum; ++i)
-    {
-        std::cout << "\t";
-        for(uint8_t j = 0; j < base_dimensions[i].size(); ++j)
-            std::cout << base_dimensions[i][j] << " ";
+    QFile param_file(GenConfigPath);
 
-        std::cout << "\n";
+    if(!param_file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "\nUnable to open HP cover parameters file. Exit...\n";
+        return nullptr;
     }
+    // Surowe bajty (UTF-8) bez konwersji przez QString
+    QByteArray contents = param_file.readAll();
 
-    std::cout << "\nOuter dimensions add-ons: \n\t";
-    for(uint8_t i = 0; i < DimNum; ++i)
-        std::cout << acc_out_dimensions[i] << " ";
-
-    std::cout << "\n\nInner dimensions add-ons: \n\t";
-    for(uint8_t i = 0; i < DimNum; ++i)
-        std::cout << acc_in_dimensions[i] << " ";
-
-    std::cout << "\n\nMinimal spaces: \n\t";
-    for(uint8_t i = 0; i < DevSides; ++i)
-        std::cout << inner_offsets[i] << " ";
+    param_file.close();
 
-    std::cout << "\n\nWall offset: \n\t" << wall_offset << "\n";
+    return CoverCatalog::loadShared(contents.constData(), contents.size());
 }
 /*!
- * \brief Read parameters of the generator from the configuration file
- *
- * Open the configuration file and start reading line by line if
- * opened without errors. Omit all lines, which start with the '#'
- * sign (considered as comments) or are simply empty. Turn the line
- * into a string stream and pass to the parser, which interprets
- * the string and distribute the values to the correct buffers.
+ * \brief Read parameters of the other product lines
  *
- * \return True if correctly loaded and false otherwise
+ * Every configuration file (text or compiled) in the folder of the
+ * families next to the executable is loaded as the separate family
+ * named after the file. Files, which are not valid, are skipped.
  */
-bool HPCover::readParameters()
+void HPCover::readFamilies()
 {
-    QFile param_file(GenConfigPath);
+    QDir families_dir(QCoreApplication::applicationDirPath() + "/" + FamiliesDirName);
+    const QFileInfoList files = families_dir.entryInfoList(QStringList() << "*.txt" << "*.hpcb", QDir::Files, QDir::Name);
 
-    if(param_file.open(QIODevice::ReadOnly))
+    for(const QFileInfo & file_info : files)
     {
-        QTextStream text_str(&param_file);
+        CatalogPtr catalog;
 
-        while(!text_str.atEnd())
+        if(file_info.suffix() == "hpcb")
+            catalog = CatalogBlob::loadFile(file_info.absoluteFilePath().toStdString());
+        else
         {
-            QString qt_line = text_str.readLine();
-            // Conversion to STD string
-            std::string line = qt_line.toStdString();
-            // Pominięcie komentarzy
-            if(line[0] == '#' || line.empty())
-                continue;
+            QFile family_file(file_info.absoluteFilePath());
 
-            std::stringstream line_stream(line);
-
-            if(!readLine(line_stream))
-                return false;
+            if(family_file.open(QIODevice::ReadOnly))
+            {
+                QByteArray contents = family_file.readAll();
+                catalog = CoverCatalog::loadShared(contents.constData(), contents.size());
+            }
         }
-    }
-    else
-    {
-        qDebug() << "\nUnable to open HP cover parameters file. Exit...\n";
-        return false;
-    }
 
-    param_file.close();
+        if(!catalog)
+        {
+            qDebug() << "Parameters of the family" << file_info.fileName() << "are not valid, family is skipped.";
+            continue;
+        }
 
-    return true;
+        families.setFamily(file_info.completeBaseName().toStdString(), catalog);
+    }
 }
 /*!
- * \brief Read and analyze the line of the file
+ * \brief Use the catalog as the main parts library
  *
- * Line should start with the name of the variable and the semicolon
- * and so it is verified at the beginning. If the line starts in this
- * way, then name of the variable is compared with the ones defined in
- * the dedicated structure. If name matches one of the strings, interpret
- * the data correctly.
+ * Catalog is used by the generator and as the first product line.
  *
- * \param[in] stream - line in the form of the string stream (easy to parse)
- * \return True if succeed and false otherwise
+ * \param[in] parts - parts library
  */
-bool HPCover::readLine(std::stringstream &stream)
+void HPCover::useCatalog(CatalogPtr parts)
 {
-    std::string var_name;
-    char sym = '\0';
+    sizer.setCatalog(parts);
+    families.setFamily(MainFamilyName, parts);
+}
+/*!
+ * \brief Read parameters of the generator
+ *
+ * Compiled configuration file placed next to the executable (update of
+ * the catalog) is used, if it is valid. Otherwise, the catalog compiled
+ * into the program is used or, if there is none, the configuration file
+ * from the resources. Loaded catalog is then shared with the generator.
+ * Parameters file watched next to the executable replaces all of them,
+ * when loaded. Catalogs of the other product lines are loaded at the end.
+ *
+ * \return True if correctly loaded and false otherwise
+ */
+bool HPCover::readParameters()
+{
+    CatalogPtr catalog = readCompiledParameters();
 
-    stream >> var_name >> sym;
+    if(!catalog)
+        catalog = EmbeddedCatalog::isAvailable() ? EmbeddedCatalog::load() : readResourceParameters();
 
-    if(sym != ':')
-    {
-        qDebug() << "\nError during reading the file. Lack of ':' symbol. Abort.\n";
+    if(!catalog)
         return false;
-    }
-
-    std::string value;
-
-    if(var_name == params.BASE_LENGTH)
-    {
-        while(stream >> value)
-            base_dimensions[0].push_back(std::stof(value));
-    }
-    else if(var_name == params.BASE_WIDTH)
-    {
-        while(stream >> value)
-            base_dimensions[1].push_back(std::stof(value));
-    }
-    else if(var_name == params.BASE_HEIGHT)
-    {
-        while(stream >> value)
-            base_dimensions[2].push_back(std::stof(value));
-    }
-    else if(var_name == params.OUT_LENGTH)
-    {
-        stream >> value;
-        acc_out_dimensions[0] = std::stof(value);
-    }
-    else if(var_name == params.OUT_WIDTH)
-    {
-        stream >> value;
-        acc_out_dimensions[1] = std::stof(value);
-    }
-    else if(var_name == params.OUT_HEIGHT)
-    {
-        stream >> value;
-        acc_out_dimensions[2] = std::stof(value);
-    }
-    else if(var_name == params.ACC_LENGTH)
-    {
-        stream >> value;
-        acc_in_dimensions[0] = std::stof(value);
-    }
-    else if(var_name == params.ACC_WIDTH)
-    {
-        stream >> value;
-        acc_in_dimensions[1] = std::stof(value);
-    }
-    else if(var_name == params.ACC_HEIGHT)
-    {
-        stream >> value;
-        acc_in_dimensions[2] = std::stof(value);
-    }
-    else if(var_name == params.FRONT_SPACE)
-    {
-        stream >> value;
-        inner_offsets[0] = std::stof(value);
-    }
-    else if(var_name == params.SIDE_SPACE)
-    {
-        stream >> value;
-        inner_offsets[1] = std::stof(value);
-    }
-
-    else if(var_name == params.BACK_SPACE)
-    {
-        stream >> value;
-        inner_offsets[2] = std::stof(value);
-    }
 
-    else if(var_name == params.TOP_SPACE)
-    {
-        stream >> value;
-        inner_offsets[3] = std::stof(value);
-    }
-    else if(var_name == params.WALL_SPACE)
-    {
-        stream >> value;
-        wall_offset = std::stof(value);
-    }
+    useCatalog(catalog);
+    readFamilies();
 
     return true;
 }
@@ -25,12 +25,17 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent)
     cover = new HPCover();
     images = new ImagesViewer("Przykłady", main_widget);
     input_dim = new DataWindow("Wymiary wewnętrzne", main_widget);
+    preview = new PreviewPanel("Podgląd", main_widget);
+    preview_timer = new QTimer(this);
     terminal = new Terminal("Komunikaty", this);
     next_button = new QPushButton("Dalej", main_widget);
     prev_button = new QPushButton("Cofnij", main_widget);
     right_column = new QVBoxLayout();
     columns = new QHBoxLayout(main_widget);
 
+    preview_timer->setSingleShot(true);
+    preview_timer->setInterval(0);
+
     setStatusBar(new QStatusBar());
     statusBar()->showMessage("Generator s|HP|");
     setFixedSize(MainWindowWidth, MainWindowHeight);
@@ -118,6 +123,8 @@ void MainWindow::makeConnections()
     connect(this->input_dim, SIGNAL(oneDataWrong(const QString &)), this, SLOT(dataWrong(const QString &)));
     connect(this->input_dim, SIGNAL(oneDataEditing()), this, SLOT(dataStillEditing()));
     connect(this->input_dim, SIGNAL(noInputsGiven()), this, SLOT(dataNotGiven()));
+    connect(this->input_dim, SIGNAL(dataUpdated()), this, SLOT(schedulePreview()));
+    connect(this->preview_timer, SIGNAL(timeout()), this, SLOT(updatePreview()));
 
     connect(this->next_button, SIGNAL(pressed()), this, SLOT(goToNextStep()));
     connect(this->prev_button, SIGNAL(pressed()), this, SLOT(goToPreviousStep()));
@@ -139,12 +146,14 @@ void MainWindow::makeConnections()
  * Rest of the elements, like contact window, results or portfolio,
  * are completed in the separate classes and only switched by
  * QStackedWidget. This method creates the right column of widgets
- * and aligns it horizontally with the image viewer. Proportions between
+ * (with the live preview below the data) and aligns it horizontally
+ * with the image viewer. Proportions between
  * the image viewer and the right column is set to 3:2.
  */
 void MainWindow::setLayout()
 {
     this->right_column->addWidget(this->input_dim);
+    this->right_column->addWidget(this->preview);
     this->right_column->addItem(new QSpacerItem(10, 15, QSizePolicy::Minimum, QSizePolicy::Preferred));
     this->right_column->addWidget(this->terminal);
     this->right_column->addItem(new QSpacerItem(10, 15, QSizePolicy::Minimum, QSizePolicy::Preferred));
@@ -338,7 +347,7 @@ void MainWindow::generateCover()
                                        cover->returnOuterDim());
 
     result_window->getGeneratorInputs(cover->returnFinalDimensions());
-    result_window->getModulesQuantity(cover->returnModulesQuantity());
+    result_window->getCoverSize(cover->returnCoverSize());
     contact->generateMail(true, result_window->returnTerminalContents());
     // Update server statistics DB
     app_statistics->updateResultsType(true);
@@ -367,6 +376,56 @@ void MainWindow::matchMessageToStep(Steps step)
             break;
     }
 }
+/*!
+ * \brief Request the update of the live preview
+ *
+ * Every change of the data field triggers the check of all inputs,
+ * so the preview is requested many times during one pass of the
+ * event loop. Timer with the zero interval calls the generator once,
+ * after all pending events have been handled, so typing never waits
+ * for the preview (also in the single-threaded WASM build).
+ */
+void MainWindow::schedulePreview()
+{
+    if(!preview_timer->isActive())
+        preview_timer->start();
+}
+/*!
+ * \brief Generate the cover from the data typed so far and display it in the preview
+ *
+ * Take the saved data together with the values typed in the current
+ * step. Dimensions of the device are required, the rest of the data
+ * is optional (defaults are used). Generate the preview without
+ * changing the results of the generator and display it along with
+ * the duration of the generation. If there are other product lines,
+ * the same data is sized for all of them.
+ */
+void MainWindow::updatePreview()
+{
+    std::vector<std::vector<int>> live_dimensions = input_dim->returnLiveDimensions();
+
+    for(int device_dim : live_dimensions[0])
+    {
+        if(device_dim == -1)
+        {
+            preview->showMissingData();
+            return;
+        }
+    }
+
+    SizingResult preview_result;
+    cover->previewCover(live_dimensions, preview_result);
+
+    preview->showResult(preview_result, cover->findCoverSize(preview_result));
+    preview->showLatency(cover->returnPreviewLatency());
+
+    if(cover->returnFamilies().returnFamiliesNum() > 1)
+    {
+        std::vector<SizingResult> family_results;
+        cover->generateFamilies(live_dimensions, family_results);
+        preview->showFamilies(cover->returnFamilies(), family_results);
+    }
+}
 /*!
  * \brief Go back to the generator part of the application
  */
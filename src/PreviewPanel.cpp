@@ -0,0 +1,171 @@
+#include "PreviewPanel.hpp"
+
+/*!
+ * \brief Initialization of the class PreviewPanel
+ *
+ * Create new instances of the inner widgets, set the geometrical
+ * behavior of the own window and display the initial information.
+ *
+ * \param[in] widget_title - title of the window
+ * \param[in] parent - pointer to the parent widget
+ */
+PreviewPanel::PreviewPanel(const char *widget_title, QWidget *parent) : FramedWidget(widget_title, parent)
+{
+    summary = new QLabel(this);
+    families_summary = new QLabel(this);
+    latency = new QLabel(this);
+
+    setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
+    setMaximumHeight(PanelMaxHeight);
+
+    setStoredWidgets();
+    setVerticalLayout();
+    showMissingData();
+}
+/*!
+ * \brief Set the settings and graphics of the inner widgets
+ *
+ * Summary uses the colors of the Terminal, duration is printed
+ * with the smaller letters below it.
+ */
+void PreviewPanel::setStoredWidgets()
+{
+    QPalette labels_palette;
+    labels_palette.setColor(QPalette::Window, QColor(QRgb(SIL_GRAY)));
+    labels_palette.setColor(QPalette::WindowText, QColor(QRgb(SIL_NAVY)));
+
+    QFont small_letters;
+    small_letters.setPointSize(8);
+
+    summary->setWordWrap(true);
+    summary->setAlignment(Qt::AlignCenter);
+    summary->setAutoFillBackground(true);
+    summary->setPalette(labels_palette);
+    summary->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+
+    families_summary->setFont(small_letters);
+    families_summary->setPalette(labels_palette);
+    families_summary->hide();
+
+    latency->setAlignment(Qt::AlignRight);
+    latency->setFont(small_letters);
+    latency->setPalette(labels_palette);
+}
+/*!
+ * \brief Align the title of the window with the stored widgets vertically
+ */
+void PreviewPanel::setVerticalLayout()
+{
+    v_layout->addWidget(title);
+    v_layout->addWidget(summary);
+    v_layout->addWidget(families_summary);
+    v_layout->addWidget(latency);
+}
+/*!
+ * \brief Display the result of the generator
+ *
+ * Show the outer dimensions, the size and the number of modules of
+ * the standard cover or the message of the error, if it cannot be
+ * generated. If the device has to be moved inside the cover to
+ * avoid the obstacle on the side, the shift is shown too. The same
+ * applies to the device, which fits only after the rotation.
+ *
+ * \param[in] result - results of the generator
+ * \param[in] size - size of the cover (from the height of the stack of the modules)
+ */
+void PreviewPanel::showResult(const SizingResult & result, COVER_SIZE size)
+{
+    if(result.error != GenErrors::COVER_OK)
+    {
+        error_msgs.raise(result.error);
+        summary->setText(error_msgs.returnErrorMessage().trimmed());
+        return;
+    }
+
+    QString text = QString("Obudowa standardowa %1: %2 x %3 x %4 mm, moduły: %5")
+                   .arg(CoverSizeNames[size])
+                   .arg(static_cast<int>(result.outer_dim[DIM_ID::LENGTH]))
+                   .arg(static_cast<int>(result.outer_dim[DIM_ID::WIDTH]))
+                   .arg(static_cast<int>(result.outer_dim[DIM_ID::HEIGHT]))
+                   .arg(static_cast<int>(result.modules));
+    // Urządzenie przesunięte w obudowie (kolizja z boku)
+    if(result.shift != 0)
+        text += QString(", urządzenie przesunięte o %1 mm w %2")
+                .arg(qAbs(static_cast<int>(result.shift)))
+                .arg((result.shift > 0) ? "prawo" : "lewo");
+    // Urządzenie obrócone o 90 stopni (zamiana szerokości i głębokości)
+    if(result.rotated)
+        text += QString(", urządzenie obrócone o 90° (szerokość %1 mm, głębokość %2 mm)")
+                .arg(result.input.device[0])
+                .arg(result.input.device[1]);
+
+    summary->setText(text);
+}
+/*!
+ * \brief Display the information about the missing dimensions of the device
+ */
+void PreviewPanel::showMissingData()
+{
+    summary->setText("Podaj wymiary urządzenia, aby zobaczyć podgląd obudowy");
+    families_summary->hide();
+    setMaximumHeight(PanelMaxHeight);
+    latency->clear();
+}
+/*!
+ * \brief Display the results of all product lines
+ *
+ * One line per family with the outer dimensions of the standard
+ * cover or the information that it does not fit. Summary is shown
+ * only if there is more than one family and the panel grows with it.
+ *
+ * \param[in] families - generators of the product lines (names)
+ * \param[in] results - results of the generator for each family
+ */
+void PreviewPanel::showFamilies(const ProductFamilies & families, const std::vector<SizingResult> & results)
+{
+    if(families.returnFamiliesNum() < 2)
+    {
+        families_summary->hide();
+        setMaximumHeight(PanelMaxHeight);
+        return;
+    }
+
+    QStringList lines;
+
+    for(size_t i = 0; i < results.size(); ++i)
+    {
+        QString name = QString::fromStdString(families.returnName(i));
+
+        if(results[i].error == GenErrors::COVER_OK)
+            lines << QString("%1: %2 x %3 x %4 mm").arg(name)
+                     .arg(static_cast<int>(results[i].outer_dim[DIM_ID::LENGTH]))
+                     .arg(static_cast<int>(results[i].outer_dim[DIM_ID::WIDTH]))
+                     .arg(static_cast<int>(results[i].outer_dim[DIM_ID::HEIGHT]));
+        else
+            lines << QString("%1: nie pasuje (obudowa specjalna)").arg(name);
+    }
+
+    families_summary->setText(lines.join("\n"));
+    families_summary->show();
+    setMaximumHeight(PanelMaxHeight + FamilyLineHeight * static_cast<int>(results.size()));
+}
+/*!
+ * \brief Display the duration of the generator
+ *
+ * Show the last duration and the 99th percentile in microseconds.
+ * Number of the generations above the budget is shown only if
+ * the budget has been exceeded at least once.
+ *
+ * \param[in] meter - durations of the preview generations
+ */
+void PreviewPanel::showLatency(const LatencyMeter & meter)
+{
+    QString text = QString("Czas doboru: %1 µs (p99: %2 µs)")
+                   .arg(meter.returnLast() / 1000.0, 0, 'f', 1)
+                   .arg(meter.returnPercentile(0.99) / 1000.0, 0, 'f', 1);
+
+    if(meter.returnOverBudget() > 0)
+        text += QString(", ponad budżet: %1").arg(meter.returnOverBudget());
+
+    latency->setText(text);
+}